@@ -0,0 +1,223 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+
+
+// Function declerations
+
+// value Asian call monitored at K, 2K, ..., 2^(levels - 1) K dates from the same paths, returning the covariance of the values
+void value_Asian_call_levels(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const int& levels, std::mt19937& rnd, std::vector<double>& values,
+	std::vector<std::vector<double>>& covariance);
+
+// continuously averaged Asian call by Richardson extrapolation of the values monitored at K, 2K and 4K dates on shared paths
+double value_Asian_call_Richardson(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const int& K, std::mt19937& rnd, double& standard_error, double& order);
+
+// Richardson extrapolation of the values at levels l, l + 1 and l + 2, returning the observed order and the weights on each level
+double Richardson(const std::vector<double>& values, const int& l, double& order, std::vector<double>& weights);
+
+// standard error of a weighted sum of correlated values
+double combination_error(const std::vector<std::vector<double>>& covariance, const std::vector<double>& weights);
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double volatility{ 0.37 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.04 };
+	double initial_share_price{ 900 };
+	int K{ 5 };  // points in the coarsest sample path
+	int levels{ 9 };  // finest path has 5 x 2^8 = 1280 points
+	int N{ 100000 };  // number of MC paths
+
+	// every level from one set of paths, so differences between levels are free of most of the MC noise
+	std::mt19937 rnd;
+	std::vector<double> values;
+	std::vector<std::vector<double>> covariance;
+	auto start = std::chrono::steady_clock::now();  // get start time
+	value_Asian_call_levels(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, levels, rnd, values, covariance);
+	auto finish = std::chrono::steady_clock::now();  // get finish time
+	auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+	// the continuous monitoring reference is the extrapolation of the three finest levels
+	double reference_order;
+	std::vector<double> reference_weights;
+	double reference = Richardson(values, levels - 3, reference_order, reference_weights);
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("Asian Richardson extrapolation.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+	output << "K,value,error,extrapolated,order,extrapolated error" << std::endl;
+
+	std::cout << std::setprecision(6);
+	std::cout << "continuous reference = " << reference << " +- " << combination_error(covariance, reference_weights) << " (order "
+		<< reference_order << "), time for " << levels << " levels = " << elapsed.count() << " s" << std::endl;
+	for (int l{ 0 }; l < levels; l++) {
+
+		// discretisation error of the raw value against the reference, from the same paths
+		std::vector<double> weights(levels, 0.);
+		weights[l] = 1;
+		for (int m{ 0 }; m < levels; m++) weights[m] -= reference_weights[m];
+		double error = values[l] - reference;
+		double error_se = combination_error(covariance, weights);
+
+		std::cout << "K = " << std::setw(5) << K * (1 << l) << ": value = " << std::setw(9) << values[l] << ", error = " << std::setw(10) << error
+			<< " +- " << std::setw(9) << error_se;
+		output << K * (1 << l) << "," << values[l] << "," << error;
+
+		// extrapolation from K, 2K and 4K
+		if (l + 2 < levels - 1) {
+			double order;
+			std::vector<double> extrapolated_weights;
+			double extrapolated = Richardson(values, l, order, extrapolated_weights);
+			for (int m{ 0 }; m < levels; m++) extrapolated_weights[m] -= reference_weights[m];
+			std::cout << ", extrapolated from K, 2K, 4K = " << std::setw(9) << extrapolated << " (order " << std::setw(8) << order << "), error = "
+				<< std::setw(10) << extrapolated - reference << " +- " << combination_error(covariance, extrapolated_weights);
+			output << "," << extrapolated << "," << order << "," << extrapolated - reference;
+		}
+		std::cout << std::endl;
+		output << std::endl;
+	}
+	output.close();
+
+	// the standalone mode at the assignment's K
+	std::mt19937 rnd_standalone;
+	double standard_error, order;
+	start = std::chrono::steady_clock::now();  // get start time
+	double value = value_Asian_call_Richardson(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, 35, rnd_standalone,
+		standard_error, order);
+	finish = std::chrono::steady_clock::now();  // get finish time
+	elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+	std::cout << "Richardson from K = 35, 70, 140: " << value << " +- " << standard_error << " (order " << order << "), time = " << elapsed.count()
+		<< " s" << std::endl;
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// value Asian call monitored at K, 2K, ..., 2^(levels - 1) K dates from the same paths, returning the covariance of the values
+// each path is stepped exactly at the finest 2^(levels - 1) K dates and level l reads off every 2^(levels - 1 - l)-th point,
+// so all levels see the same Brownian motion; covariance[l][m] is the covariance of the discounted estimates, not of the payoffs
+void value_Asian_call_levels(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const int& levels, std::mt19937& rnd, std::vector<double>& values,
+	std::vector<std::vector<double>>& covariance)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	int fine_steps = K << (levels - 1);
+	double dt{ expiration / fine_steps };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+	double log_initial_share_price = log(initial_share_price);
+
+	// initalise sums to zero
+	std::vector<double> sums(levels, 0.), A_sums(levels, 0.), payoffs(levels, 0.);
+	std::vector<std::vector<double>> sum_products(levels, std::vector<double>(levels, 0.));
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		// step the finest path, adding each point to every level that monitors it
+		double log_share_price = log_initial_share_price;
+		double share_price{ initial_share_price };
+		std::fill(A_sums.begin(), A_sums.end(), 0.);
+		for (int j{ 1 }; j <= fine_steps; j++) {
+			log_share_price += drift + diffusion * ND(rnd);
+			share_price = exp(log_share_price);
+			for (int l{ levels - 1 }, stride{ 1 }; l >= 0 && j % stride == 0; l--, stride *= 2) A_sums[l] += share_price;
+		}
+
+		// add in the payoffs
+		for (int l{ 0 }; l < levels; l++) {
+			payoffs[l] = std::max(share_price - A_sums[l] / (K << l), 0.);
+			sums[l] += payoffs[l];
+		}
+		for (int l{ 0 }; l < levels; l++) {
+			for (int m{ l }; m < levels; m++) sum_products[l][m] += payoffs[l] * payoffs[m];
+		}
+	}
+
+	// average over all paths
+	double discount = exp(-interest_rate * expiration);
+	values = std::vector<double>(levels);
+	covariance = std::vector<std::vector<double>>(levels, std::vector<double>(levels, 0.));
+	for (int l{ 0 }; l < levels; l++) values[l] = discount * sums[l] / N;
+	for (int l{ 0 }; l < levels; l++) {
+		for (int m{ l }; m < levels; m++) {
+			covariance[l][m] = pow(discount, 2) * (sum_products[l][m] / N - (sums[l] / N) * (sums[m] / N)) / (N - 1.);
+			covariance[m][l] = covariance[l][m];
+		}
+	}
+}
+
+// continuously averaged Asian call by Richardson extrapolation of the values monitored at K, 2K and 4K dates on shared paths
+// the standard error treats the observed order as fixed
+double value_Asian_call_Richardson(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const int& K, std::mt19937& rnd, double& standard_error, double& order)
+{
+	std::vector<double> values, weights;
+	std::vector<std::vector<double>> covariance;
+	value_Asian_call_levels(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, 3, rnd, values, covariance);
+	double value = Richardson(values, 0, order, weights);
+	standard_error = combination_error(covariance, weights);
+	return value;
+}
+
+// Richardson extrapolation of the values at levels l, l + 1 and l + 2, returning the observed order and the weights on each level
+// with V_K = V + c K^-p the order is p = log2((V_2K - V_K) / (V_4K - V_2K)) and V = V_4K + (V_4K - V_2K) / (2^p - 1);
+// if the observed order is outside [0.5, 4] the differences do not shrink geometrically (noise dominates) and the order falls back
+// to 1, the order of the discrete average, since an order near 0 would multiply the noise in the fine difference by 1 / (2^p - 1)
+double Richardson(const std::vector<double>& values, const int& l, double& order, std::vector<double>& weights)
+{
+	double coarse_difference = values[l + 1] - values[l];
+	double fine_difference = values[l + 2] - values[l + 1];
+	double observed_order = log2(coarse_difference / fine_difference);
+	order = (observed_order >= 0.5 && observed_order <= 4) ? observed_order : 1;
+
+	double c = 1 / (pow(2, order) - 1);
+	weights = std::vector<double>(values.size(), 0.);
+	weights[l + 1] = -c;
+	weights[l + 2] = 1 + c;
+	return values[l + 2] + c * fine_difference;
+}
+
+// standard error of a weighted sum of correlated values
+double combination_error(const std::vector<std::vector<double>>& covariance, const std::vector<double>& weights)
+{
+	double variance{ 0 };
+	for (int l{ 0 }; l < weights.size(); l++) {
+		for (int m{ 0 }; m < weights.size(); m++) variance += weights[l] * weights[m] * covariance[l][m];
+	}
+	return pow(std::max(variance, 0.), 0.5);
+}
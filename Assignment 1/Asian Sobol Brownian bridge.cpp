@@ -0,0 +1,363 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <string>
+
+
+// Sobol primitive polynomials and initial direction numbers for dimensions 2 to 37 (Joe and Kuo, new-joe-kuo-6.21201):
+// degree s, the inner coefficients a of the polynomial as bits, then m_1 ... m_s
+const std::vector<std::vector<unsigned int>> Sobol_table{
+	{ 1, 0, 1 }, { 2, 1, 1, 3 }, { 3, 1, 1, 3, 1 }, { 3, 2, 1, 1, 1 }, { 4, 1, 1, 1, 3, 3 }, { 4, 4, 1, 3, 5, 13 },
+	{ 5, 2, 1, 1, 5, 5, 17 }, { 5, 4, 1, 1, 5, 5, 5 }, { 5, 7, 1, 1, 7, 11, 19 }, { 5, 11, 1, 1, 5, 1, 1 }, { 5, 13, 1, 1, 1, 3, 11 },
+	{ 5, 14, 1, 3, 5, 5, 31 }, { 6, 1, 1, 3, 3, 9, 7, 49 }, { 6, 13, 1, 1, 1, 15, 21, 21 }, { 6, 16, 1, 3, 1, 13, 27, 49 },
+	{ 6, 19, 1, 1, 1, 15, 7, 5 }, { 6, 22, 1, 3, 1, 15, 13, 25 }, { 6, 25, 1, 1, 5, 5, 19, 61 }, { 7, 1, 1, 3, 7, 11, 23, 15, 103 },
+	{ 7, 4, 1, 3, 7, 13, 13, 15, 69 }, { 7, 7, 1, 1, 3, 13, 7, 35, 63 }, { 7, 8, 1, 3, 5, 9, 1, 25, 53 }, { 7, 14, 1, 3, 1, 13, 9, 35, 107 },
+	{ 7, 19, 1, 3, 1, 5, 27, 61, 31 }, { 7, 21, 1, 1, 5, 11, 19, 41, 61 }, { 7, 28, 1, 3, 5, 3, 3, 13, 69 }, { 7, 31, 1, 1, 7, 13, 1, 19, 1 },
+	{ 7, 32, 1, 3, 7, 5, 13, 19, 59 }, { 7, 37, 1, 1, 3, 9, 25, 29, 41 }, { 7, 41, 1, 3, 5, 13, 23, 1, 55 }, { 7, 42, 1, 3, 7, 3, 13, 59, 17 },
+	{ 7, 50, 1, 3, 1, 3, 5, 53, 69 }, { 7, 55, 1, 1, 5, 5, 23, 33, 13 }, { 7, 56, 1, 1, 7, 7, 1, 61, 123 }, { 7, 59, 1, 1, 7, 9, 13, 61, 49 },
+	{ 7, 62, 1, 3, 3, 5, 3, 55, 33 } };
+
+
+// Sobol points in up to 37 dimensions, in Gray code order from the second point, with an optional random digital shift
+class Sobol_sequence
+{
+public:
+	Sobol_sequence(const int& dimensions, const unsigned int& seed);
+	void next(std::vector<double>& point);
+private:
+	std::vector<std::vector<unsigned int>> direction;  // 32 direction numbers per dimension
+	std::vector<unsigned int> state, shift;
+	unsigned int index{ 0 };
+};
+
+// Brownian bridge construction of W(t_1) ... W(t_K) at t_k = k dt, the first normal sets W(T) and each later normal
+// fills the middle of the largest remaining gap, so the first coordinates carry the coarse shape of the path
+class Brownian_bridge
+{
+public:
+	Brownian_bridge(const int& K, const double& dt);
+	void build(const std::vector<double>& normals, std::vector<double>& path) const;
+private:
+	std::vector<int> bridge_index, left_index, right_index;
+	std::vector<double> left_weight, right_weight, standard_deviation;
+};
+
+
+// path constructions of value_Asian_call
+const std::vector<std::string> path_names{ "pseudo random", "Sobol incremental", "Sobol Brownian bridge" };
+
+
+// Function declerations
+
+// value Asian call with pseudo random or Sobol normals and incremental or Brownian bridge path construction
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const int& path_method, const unsigned int& seed);
+
+// inverse of the normal cummulative distribution
+double inverse_norm_cumm(const double& p);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double volatility{ 0.37 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.04 };
+	double initial_share_price{ 900 };
+	int K{ 35 };  // points in the sample path
+	int repetitions{ 16 };  // independent seeds or random shifts, giving the error of each estimate
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("Asian QMC.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+	std::cout << std::setprecision(6);
+
+	// error against N for each construction
+	std::vector<double> log_N;
+	std::vector<std::vector<double>> log_error(path_names.size());
+	std::cout << std::setw(8) << "N";
+	for (int m{ 0 }; m < path_names.size(); m++) std::cout << std::setw(24) << path_names[m];
+	std::cout << std::endl;
+	for (int N{ 256 }; N <= 16384; N *= 2) {
+
+		std::cout << std::setw(8) << N;
+		output << N;
+		log_N.push_back(log(N));
+		for (int m{ 0 }; m < path_names.size(); m++) {
+
+			// calculate the mean and variance over the repetitions
+			std::vector<double> samples;
+			for (int i{ 0 }; i < repetitions; i++) {
+				samples.push_back(value_Asian_call(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, m, i + 1));
+			}
+			double sum_mean{ 0 };
+			for (int i{ 0 }; i < samples.size(); i++) sum_mean += samples[i];
+			double sample_mean = sum_mean / repetitions;
+			double sum_var{ 0 };
+			for (int i{ 0 }; i < samples.size(); i++) sum_var += pow(samples[i] - sample_mean, 2);
+
+			// error of a single estimate with N paths
+			double error = sqrt(sum_var / (repetitions - 1.));
+			log_error[m].push_back(log(error));
+			std::cout << std::setw(12) << sample_mean << " +- " << std::setw(8) << error;
+			output << "," << sample_mean << "," << error;
+		}
+		std::cout << std::endl;
+		output << std::endl;
+	}
+	output.close();
+
+	// observed convergence order, the slope of log error against log N
+	for (int m{ 0 }; m < path_names.size(); m++) {
+		double mean_x{ 0 }, mean_y{ 0 };
+		for (int i{ 0 }; i < log_N.size(); i++) {
+			mean_x += log_N[i] / log_N.size();
+			mean_y += log_error[m][i] / log_N.size();
+		}
+		double sxy{ 0 }, sxx{ 0 };
+		for (int i{ 0 }; i < log_N.size(); i++) {
+			sxy += (log_N[i] - mean_x) * (log_error[m][i] - mean_y);
+			sxx += pow(log_N[i] - mean_x, 2);
+		}
+		std::cout << path_names[m] << ": error ~ N^" << sxy / sxx << ", error at N = 16384 is " << exp(log_error[0].back() - log_error[m].back())
+			<< " times smaller than pseudo random" << std::endl;
+	}
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// value Asian call with pseudo random or Sobol normals and incremental or Brownian bridge path construction
+// the Sobol point of a path has K coordinates, with incremental construction coordinate k drives step k and with the
+// Brownian bridge coordinate 1 drives W(T), coordinate 2 drives W(T / 2) and so on
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const int& path_method, const unsigned int& seed)
+{
+	// random number generators
+	std::mt19937 rnd(seed);
+	std::normal_distribution<double> ND(0., 1.);
+	Sobol_sequence Sobol(K, seed);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double mu = interest_rate - dividend_rate - 0.5 * pow(volatility, 2);
+	Brownian_bridge bridge(K, dt);
+
+	// work space reused for every path
+	std::vector<double> point(K), normals(K), path(K);
+
+	// initalise sum to zero
+	double sum{ 0 };
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		// normals for the path
+		if (path_method == 0) {
+			for (int k{ 0 }; k < K; k++) normals[k] = ND(rnd);
+		}
+		else {
+			Sobol.next(point);
+			for (int k{ 0 }; k < K; k++) normals[k] = inverse_norm_cumm(point[k]);
+		}
+
+		// Brownian motion at the monitoring dates
+		if (path_method == 2) bridge.build(normals, path);
+		else {
+			double W{ 0 };
+			for (int k{ 0 }; k < K; k++) {
+				W += normals[k] * pow(dt, 0.5);
+				path[k] = W;
+			}
+		}
+
+		// calculate A
+		double share_price{ initial_share_price };
+		double A_sum{ 0 };
+		for (int k{ 0 }; k < K; k++) {
+			share_price = initial_share_price * exp(mu * (k + 1) * dt + volatility * path[k]);
+			A_sum += share_price;
+		}
+
+		// add in the payoff
+		sum += std::max(share_price - A_sum / K, 0.);
+	}
+
+	// average over all paths
+	return exp(-interest_rate * expiration) * sum / N;
+}
+
+// Sobol sequence, seed 0 gives the unshifted sequence
+Sobol_sequence::Sobol_sequence(const int& dimensions, const unsigned int& seed)
+{
+	if (dimensions > Sobol_table.size() + 1) {
+		std::cout << "Error: Sobol sequence has at most " << Sobol_table.size() + 1 << " dimensions" << std::endl;
+		exit(1);
+	}
+
+	// the first dimension is van der Corput in base 2
+	direction.push_back(std::vector<unsigned int>(32));
+	for (int k{ 0 }; k < 32; k++) direction[0][k] = 1u << (31 - k);
+
+	// the rest from the recurrence of their primitive polynomial
+	for (int d{ 1 }; d < dimensions; d++) {
+		const std::vector<unsigned int>& row = Sobol_table[d - 1];
+		int s = row[0];
+		unsigned int a = row[1];
+		std::vector<unsigned int> v(32);
+		for (int k{ 0 }; k < 32; k++) {
+			if (k < s) v[k] = row[2 + k] << (31 - k);
+			else {
+				v[k] = v[k - s] ^ (v[k - s] >> s);
+				for (int i{ 1 }; i < s; i++) if ((a >> (s - 1 - i)) & 1) v[k] ^= v[k - i];
+			}
+		}
+		direction.push_back(v);
+	}
+
+	// random digital shift
+	state = std::vector<unsigned int>(dimensions, 0);
+	shift = std::vector<unsigned int>(dimensions, 0);
+	if (seed != 0) {
+		std::mt19937 rnd(seed);
+		for (int d{ 0 }; d < dimensions; d++) shift[d] = rnd();
+	}
+}
+
+// next Sobol point, each coordinate in (0, 1)
+void Sobol_sequence::next(std::vector<double>& point)
+{
+	// Gray code: point n differs from point n - 1 by the direction number at the lowest zero bit of n - 1
+	int c{ 0 };
+	unsigned int value = index;
+	while (value & 1) {
+		value >>= 1;
+		c++;
+	}
+	index++;
+
+	for (int d{ 0 }; d < state.size(); d++) {
+		state[d] ^= direction[d][c];
+		point[d] = ((state[d] ^ shift[d]) + 0.5) / 4294967296.;
+	}
+}
+
+// Brownian bridge construction order and weights for K equal steps of dt
+Brownian_bridge::Brownian_bridge(const int& K, const double& dt)
+	: bridge_index(K), left_index(K), right_index(K), left_weight(K), right_weight(K), standard_deviation(K)
+{
+	std::vector<double> t(K);
+	for (int k{ 0 }; k < K; k++) t[k] = (k + 1) * dt;
+
+	// the end point first
+	std::vector<int> filled(K, 0);
+	filled[K - 1] = 1;
+	bridge_index[0] = K - 1;
+	standard_deviation[0] = pow(t[K - 1], 0.5);
+
+	// then the middle of each gap, sweeping left to right and starting again at the left until all are filled
+	int j{ 0 };
+	for (int i{ 1 }; i < K; i++) {
+
+		// first unfilled point and the filled point that closes the gap
+		while (filled[j]) j++;
+		int k{ j };
+		while (!filled[k]) k++;
+
+		// middle of the gap, between the filled points j - 1 (or time 0) and k
+		int l = j + ((k - 1 - j) >> 1);
+		filled[l] = 1;
+		bridge_index[i] = l;
+		left_index[i] = j;
+		right_index[i] = k;
+		double t_left = (j == 0) ? 0 : t[j - 1];
+		left_weight[i] = (t[k] - t[l]) / (t[k] - t_left);
+		right_weight[i] = (t[l] - t_left) / (t[k] - t_left);
+		standard_deviation[i] = pow((t[l] - t_left) * (t[k] - t[l]) / (t[k] - t_left), 0.5);
+
+		j = k + 1;
+		if (j >= K) j = 0;
+	}
+}
+
+// build W(t_1) ... W(t_K) from K normals
+void Brownian_bridge::build(const std::vector<double>& normals, std::vector<double>& path) const
+{
+	path[bridge_index[0]] = standard_deviation[0] * normals[0];
+	for (int i{ 1 }; i < bridge_index.size(); i++) {
+		int j = left_index[i], k = right_index[i], l = bridge_index[i];
+		double left = (j == 0) ? 0 : path[j - 1];
+		path[l] = left_weight[i] * left + right_weight[i] * path[k] + standard_deviation[i] * normals[i];
+	}
+}
+
+// inverse of the normal cummulative distribution
+// rational approximation (Acklam) refined with one Halley step against norm_cumm, accurate to about 1e-15
+double inverse_norm_cumm(const double& p)
+{
+	const double a[6]{ -3.969683028665376e+01, 2.209460984245205e+02, -2.759285104469687e+02, 1.383577518672690e+02,
+		-3.066479806614716e+01, 2.506628277459239e+00 };
+	const double b[5]{ -5.447609879822406e+01, 1.615858368580409e+02, -1.556989798598866e+02, 6.680131188771972e+01,
+		-1.328068155288572e+01 };
+	const double c[6]{ -7.784894002430293e-03, -3.223964580411365e-01, -2.400758277161838e+00, -2.549732539343734e+00,
+		4.374664141464968e+00, 2.938163982698783e+00 };
+	const double d[4]{ 7.784695709041462e-03, 3.224671290700398e-01, 2.445134137142996e+00, 3.754408661907416e+00 };
+	const double p_low{ 0.02425 };
+
+	double x;
+	if (p < p_low) {
+		double q = pow(-2 * log(p), 0.5);
+		x = (((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1);
+	}
+	else if (p <= 1 - p_low) {
+		double q = p - 0.5;
+		double r = q * q;
+		x = (((((a[0] * r + a[1]) * r + a[2]) * r + a[3]) * r + a[4]) * r + a[5]) * q
+			/ (((((b[0] * r + b[1]) * r + b[2]) * r + b[3]) * r + b[4]) * r + 1);
+	}
+	else {
+		double q = pow(-2 * log(1 - p), 0.5);
+		x = -(((((c[0] * q + c[1]) * q + c[2]) * q + c[3]) * q + c[4]) * q + c[5]) / ((((d[0] * q + d[1]) * q + d[2]) * q + d[3]) * q + 1);
+	}
+
+	// Halley step
+	double e = norm_cumm(x) - p;
+	double u = e * pow(2 * M_PI, 0.5) * exp(0.5 * x * x);
+	return x - u / (1 + 0.5 * x * u);
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x)
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
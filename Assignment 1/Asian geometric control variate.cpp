@@ -0,0 +1,245 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+
+
+// Function declerations
+
+// value Asian call, optionally with the geometric average Asian call on the same path as a control variate
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, const bool& control_variate, std::mt19937& rnd, double& standard_error,
+	double& variance_reduction);
+
+// value geometric average Asian call max(S_T - G, 0) by monte carlo, to check the closed form
+double value_geometric_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const double& K, std::mt19937& rnd, double& standard_error);
+
+// analytic geometric average Asian call max(S_T - G, 0) with K equally spaced monitoring dates
+double analytic_geometric_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& K);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double volatility{ 0.37 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.04 };
+	double initial_share_price{ 900 };
+	double K{ 35 };  // points in the sample path
+
+	std::cout << std::setprecision(8);
+
+	// the closed form against simulation
+	std::mt19937 rnd;
+	double geometric_error;
+	double geometric_analytic = analytic_geometric_Asian_call(initial_share_price, interest_rate, dividend_rate, volatility, expiration, K);
+	double geometric_MC = value_geometric_Asian_call(initial_share_price, interest_rate, dividend_rate, volatility, expiration, 1000000, K, rnd,
+		geometric_error);
+	std::cout << "geometric Asian: analytic = " << geometric_analytic << ", MC = " << geometric_MC << " +- " << geometric_error
+		<< ", standard errors = " << (geometric_MC - geometric_analytic) / geometric_error << std::endl;
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("Asian geometric control variate.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+
+	// plain and control variate estimates from the same paths
+	std::vector<int> N_store{ 10000, 100000, 1500000 };
+	for (int N : N_store) {
+
+		std::vector<double> values, errors, times;
+		double variance_reduction{ 1 };
+		for (int control_variate{ 0 }; control_variate < 2; control_variate++) {
+
+			std::mt19937 rnd;
+			double standard_error;
+			auto start = std::chrono::steady_clock::now();  // get start time
+			values.push_back(value_Asian_call(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, control_variate, rnd,
+				standard_error, variance_reduction));
+			auto finish = std::chrono::steady_clock::now();  // get finish time
+			auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+			errors.push_back(standard_error);
+			times.push_back(elapsed.count());
+		}
+
+		// efficiency gain is the reduction in variance x time
+		double efficiency = pow(errors[0], 2) * times[0] / (pow(errors[1], 2) * times[1]);
+		std::cout << "N = " << std::setw(7) << N << ": plain = " << values[0] << " +- " << errors[0] << ", control variate = " << values[1] << " +- "
+			<< errors[1] << ", variance reduction = " << variance_reduction << ", efficiency gain = " << efficiency << std::endl;
+		output << N << "," << values[0] << "," << errors[0] << "," << values[1] << "," << errors[1] << "," << variance_reduction << ","
+			<< efficiency << std::endl;
+	}
+	output.close();
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// value Asian call, optionally with the geometric average Asian call on the same path as a control variate
+// the geometric average needs only a running sum of the log share prices next to the running sum of the share prices,
+// the coefficient is the optimal cov(Y, C) / var(C) from the same paths and variance_reduction returns var(Y) / var(Y - beta C)
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, const bool& control_variate, std::mt19937& rnd, double& standard_error,
+	double& variance_reduction)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+	double log_initial_share_price = log(initial_share_price);
+	int steps = (int)K;
+
+	// undiscounted mean of the control
+	double control_mean = exp(interest_rate * expiration) * analytic_geometric_Asian_call(initial_share_price, interest_rate, dividend_rate,
+		volatility, expiration, K);
+
+	// initalise sums to zero, the control is centred on its mean
+	double sum{ 0 }, sum_sq{ 0 }, sum_control{ 0 }, sum_control_sq{ 0 }, sum_product{ 0 };
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		// step the path, accumulating both averages as we go
+		double log_share_price = log_initial_share_price;
+		double share_price{ initial_share_price };
+		double A_sum{ 0 }, log_G_sum{ 0 };
+		for (int j{ 0 }; j < steps; j++) {
+			log_share_price += drift + diffusion * ND(rnd);
+			share_price = exp(log_share_price);
+			A_sum += share_price;
+			log_G_sum += log_share_price;
+		}
+
+		// add in the payoffs
+		double payoff = std::max(share_price - A_sum / K, 0.);
+		sum += payoff;
+		sum_sq += payoff * payoff;
+		if (control_variate) {
+			double control = std::max(share_price - exp(log_G_sum / K), 0.) - control_mean;
+			sum_control += control;
+			sum_control_sq += control * control;
+			sum_product += payoff * control;
+		}
+	}
+
+	// plain estimate
+	double mean = sum / N;
+	double variance = sum_sq / N - mean * mean;
+	variance_reduction = 1;
+	if (!control_variate) {
+		standard_error = exp(-interest_rate * expiration) * sqrt(variance / (N - 1.));
+		return exp(-interest_rate * expiration) * mean;
+	}
+
+	// control variate estimate with the optimal coefficient
+	double mean_control = sum_control / N;
+	double covariance = sum_product / N - mean * mean_control;
+	double variance_control = sum_control_sq / N - mean_control * mean_control;
+	double beta = covariance / variance_control;
+	double residual_variance = variance - 2 * beta * covariance + beta * beta * variance_control;
+	variance_reduction = variance / residual_variance;
+
+	standard_error = exp(-interest_rate * expiration) * sqrt(residual_variance / (N - 1.));
+	return exp(-interest_rate * expiration) * (mean - beta * mean_control);
+}
+
+// value geometric average Asian call max(S_T - G, 0) by monte carlo, to check the closed form
+double value_geometric_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const double& K, std::mt19937& rnd, double& standard_error)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+	int steps = (int)K;
+
+	// initalise sums to zero
+	double sum{ 0 }, sum_sq{ 0 };
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		double log_share_price = log(initial_share_price);
+		double log_G_sum{ 0 };
+		for (int j{ 0 }; j < steps; j++) {
+			log_share_price += drift + diffusion * ND(rnd);
+			log_G_sum += log_share_price;
+		}
+
+		double payoff = std::max(exp(log_share_price) - exp(log_G_sum / K), 0.);
+		sum += payoff;
+		sum_sq += payoff * payoff;
+	}
+
+	// average over all paths
+	double mean = sum / N;
+	standard_error = exp(-interest_rate * expiration) * sqrt((sum_sq / N - mean * mean) / (N - 1.));
+	return exp(-interest_rate * expiration) * mean;
+}
+
+// analytic geometric average Asian call max(S_T - G, 0) with K equally spaced monitoring dates
+// with t_i = i dt, log S_T and log G = (1 / K) sum log S(t_i) are jointly normal, so the option is an exchange option between
+// two lognormals: e^{-rT} (E[S_T] N(d1) - E[G] N(d2)) with v^2 = var(log S_T - log G), d1 = (log(E[S_T] / E[G]) + v^2 / 2) / v
+double analytic_geometric_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& K)
+{
+	double dt{ expiration / K };
+	double mu = interest_rate - dividend_rate - 0.5 * pow(volatility, 2);
+
+	// moments of log G, var(sum W(t_i)) = dt sum_{i,j} min(i, j) = dt K (K + 1) (2K + 1) / 6
+	double mean_log_G = log(initial_share_price) + mu * dt * (K + 1) / 2;
+	double variance_log_G = pow(volatility, 2) * dt * (K + 1) * (2 * K + 1) / (6 * K);
+	double covariance = pow(volatility, 2) * dt * (K + 1) / 2;  // cov(log S_T, log G) = sigma^2 (1 / K) sum t_i
+
+	// expected values and the variance of the log ratio
+	double expected_S = initial_share_price * exp((interest_rate - dividend_rate) * expiration);
+	double expected_G = exp(mean_log_G + 0.5 * variance_log_G);
+	double v = pow(pow(volatility, 2) * expiration + variance_log_G - 2 * covariance, 0.5);
+
+	double d1_val = (log(expected_S / expected_G) + 0.5 * pow(v, 2)) / v;
+	double d2_val = d1_val - v;
+
+	return exp(-interest_rate * expiration) * (expected_S * norm_cumm(d1_val) - expected_G * norm_cumm(d2_val));
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x)
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
@@ -0,0 +1,237 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+
+
+// Function declerations
+
+// multilevel monte carlo value of the Asian call, level l monitors 2^l equally spaced dates
+// adds levels and samples until the estimated root mean square error is below target_RMSE, converged is false if max_level
+// was reached with the bias test still failing
+double value_Asian_call_MLMC(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const double& target_RMSE, const int& max_level, std::mt19937& rnd, std::vector<long long>& level_N,
+	std::vector<double>& level_mean, std::vector<double>& level_variance, std::vector<double>& level_cost, double& single_level_cost, bool& converged);
+
+// add N samples of P_l - P_(l-1) to the sums of a level, the fine and coarse paths share their Brownian increments
+// sums holds the sums of Y, Y^2, P_l and P_l^2
+void Asian_level_samples(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& level, const long long& N, std::mt19937& rnd, std::vector<double>& sums);
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double volatility{ 0.37 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.04 };
+	double initial_share_price{ 900 };
+	int max_level{ 10 };  // at most 1024 monitoring dates
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("Asian MLMC.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+	output << "target RMSE,level,N,mean,variance,cost" << std::endl;
+	std::cout << std::setprecision(6);
+
+	std::vector<double> targets{ 0.4, 0.2, 0.1 };
+	for (int t{ 0 }; t < targets.size(); t++) {
+
+		std::mt19937 rnd(t + 1);
+		std::vector<long long> level_N;
+		std::vector<double> level_mean, level_variance, level_cost;
+		double single_level_cost;
+		bool converged;
+
+		auto start = std::chrono::steady_clock::now();  // get start time
+		double value = value_Asian_call_MLMC(initial_share_price, interest_rate, dividend_rate, volatility, expiration, targets[t], max_level, rnd,
+			level_N, level_mean, level_variance, level_cost, single_level_cost, converged);
+		auto finish = std::chrono::steady_clock::now();  // get finish time
+		auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+		// report the levels
+		double total_cost{ 0 };
+		std::cout << "target RMSE = " << targets[t] << ": V = " << value << ", levels = " << level_N.size() - 1 << " (K = "
+			<< (1 << (level_N.size() - 1)) << "), time = " << elapsed.count() << " s" << std::endl;
+		if (!converged) std::cout << "  Warning: bias test failed at the maximum level, the target RMSE is not met" << std::endl;
+		for (int l{ 0 }; l < level_N.size(); l++) {
+			std::cout << "  level " << std::setw(2) << l << ": N = " << std::setw(9) << level_N[l] << ", mean = " << std::setw(12) << level_mean[l]
+				<< ", variance = " << std::setw(12) << level_variance[l] << ", cost per sample = " << level_cost[l] << std::endl;
+			output << targets[t] << "," << l << "," << level_N[l] << "," << level_mean[l] << "," << level_variance[l] << "," << level_cost[l] << std::endl;
+			total_cost += level_N[l] * level_cost[l];
+		}
+		std::cout << "  MLMC cost = " << total_cost << " steps, single level cost = " << single_level_cost << " steps, ratio = "
+			<< single_level_cost / total_cost << std::endl;
+	}
+	output.close();
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// multilevel monte carlo value of the Asian call, level l monitors 2^l equally spaced dates
+// follows Giles (2008): start with levels 0 to 2, set N_l = 2 eps^-2 sqrt(V_l / C_l) sum_k sqrt(V_k C_k) from the estimated
+// variance V_l and cost C_l of each level, and add a level while the bias estimate |E[Y_L]| / (2^alpha - 1) exceeds eps / sqrt(2);
+// single_level_cost is the cost of plain monte carlo at the finest level reaching the same error, and reaching max_level with the
+// bias test still failing stops with converged false rather than claiming the target
+double value_Asian_call_MLMC(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const double& target_RMSE, const int& max_level, std::mt19937& rnd, std::vector<long long>& level_N,
+	std::vector<double>& level_mean, std::vector<double>& level_variance, std::vector<double>& level_cost, double& single_level_cost, bool& converged)
+{
+	long long pilot_N{ 10000 };
+	int L{ 2 };
+
+	// sums of Y, Y^2, P and P^2 per level
+	std::vector<std::vector<double>> sums;
+	level_N.clear();
+	level_mean.clear();
+	level_variance.clear();
+	level_cost.clear();
+
+	converged = false;
+	bool finished{ false };
+	while (!finished) {
+
+		// pilot samples on any new level, the cost of a sample is the number of fine plus coarse steps
+		while (level_N.size() <= L) {
+			int l = level_N.size();
+			sums.push_back(std::vector<double>(4, 0.));
+			Asian_level_samples(initial_share_price, interest_rate, dividend_rate, volatility, expiration, l, pilot_N, rnd, sums[l]);
+			level_N.push_back(pilot_N);
+			level_cost.push_back((l == 0) ? 1 : pow(2, l) + pow(2, l - 1));
+			level_mean.push_back(0);
+			level_variance.push_back(0);
+		}
+
+		// update the estimates and the optimal number of samples
+		double sum_root{ 0 };
+		for (int l{ 0 }; l <= L; l++) {
+			level_mean[l] = sums[l][0] / level_N[l];
+			level_variance[l] = std::max(sums[l][1] / level_N[l] - pow(level_mean[l], 2), 0.);
+			sum_root += pow(level_variance[l] * level_cost[l], 0.5);
+		}
+		bool extra{ false };
+		for (int l{ 0 }; l <= L; l++) {
+			long long optimal_N = (long long)ceil(2 * pow(target_RMSE, -2) * pow(level_variance[l] / level_cost[l], 0.5) * sum_root);
+			if (optimal_N > level_N[l]) {
+				Asian_level_samples(initial_share_price, interest_rate, dividend_rate, volatility, expiration, l, optimal_N - level_N[l], rnd, sums[l]);
+				level_N[l] = optimal_N;
+				extra = true;
+			}
+		}
+		if (extra) continue;
+
+		// weak order alpha from the decay of |E[Y_l]| over the finer levels, at least 0.5, levels with a zero mean have no
+		// logarithm and are left out, and with fewer than two levels left alpha stays at 0.5
+		double sxy{ 0 }, sxx{ 0 }, mean_x{ 0 }, mean_y{ 0 };
+		int fitted{ 0 };
+		for (int l{ 1 }; l <= L; l++) {
+			if (level_mean[l] == 0) continue;
+			mean_x += l;
+			mean_y += log2(fabs(level_mean[l]));
+			fitted++;
+		}
+		double alpha{ 0.5 };
+		if (fitted >= 2) {
+			mean_x /= fitted;
+			mean_y /= fitted;
+			for (int l{ 1 }; l <= L; l++) {
+				if (level_mean[l] == 0) continue;
+				sxy += (l - mean_x) * (log2(fabs(level_mean[l])) - mean_y);
+				sxx += pow(l - mean_x, 2);
+			}
+			alpha = std::max(0.5, -sxy / sxx);
+		}
+
+		// bias test on the finest level, using the level below to guard against a chance small mean
+		double bias = std::max(fabs(level_mean[L]), 0.5 * fabs(level_mean[L - 1])) / (pow(2, alpha) - 1);
+		if (bias < target_RMSE / pow(2, 0.5)) converged = finished = true;
+		else if (L == max_level) finished = true;
+		else L++;
+	}
+
+	// plain monte carlo at level L needs var(P_L) 2 / eps^2 paths of 2^L steps
+	double mean_P = sums[L][2] / level_N[L];
+	double variance_P = sums[L][3] / level_N[L] - mean_P * mean_P;
+	single_level_cost = 2 * variance_P * pow(target_RMSE, -2) * pow(2, L);
+
+	// sum of the level means
+	double value{ 0 };
+	for (int l{ 0 }; l <= L; l++) value += level_mean[l];
+	return exp(-interest_rate * expiration) * value;
+}
+
+// add N samples of P_l - P_(l-1) to the sums of a level, the fine and coarse paths share their Brownian increments
+// the coarse path takes the sum of each pair of fine increments, so the difference has small variance; payoffs are undiscounted
+void Asian_level_samples(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& level, const long long& N, std::mt19937& rnd, std::vector<double>& sums)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	int fine_steps = 1 << level;
+	double dt{ expiration / fine_steps };
+	double mu = interest_rate - dividend_rate - 0.5 * pow(volatility, 2);
+	double root_dt = pow(dt, 0.5);
+	double log_initial_share_price = log(initial_share_price);
+
+	// loop over all MC paths
+	for (long long i{ 0 }; i < N; i++) {
+
+		double log_fine = log_initial_share_price, log_coarse = log_initial_share_price;
+		double A_fine{ 0 }, A_coarse{ 0 };
+		double coarse_increment{ 0 };
+		for (int j{ 0 }; j < fine_steps; j++) {
+
+			// fine step
+			double dW = root_dt * ND(rnd);
+			log_fine += mu * dt + volatility * dW;
+			A_fine += exp(log_fine);
+
+			// coarse step every second fine step
+			coarse_increment += dW;
+			if (level > 0 && j % 2 == 1) {
+				log_coarse += mu * 2 * dt + volatility * coarse_increment;
+				A_coarse += exp(log_coarse);
+				coarse_increment = 0;
+			}
+		}
+
+		// payoffs of the fine and coarse paths
+		double P_fine = std::max(exp(log_fine) - A_fine / fine_steps, 0.);
+		double P_coarse = (level > 0) ? std::max(exp(log_coarse) - A_coarse / (fine_steps / 2), 0.) : 0;
+		double Y = P_fine - P_coarse;
+
+		sums[0] += Y;
+		sums[1] += Y * Y;
+		sums[2] += P_fine;
+		sums[3] += P_fine * P_fine;
+	}
+}
@@ -0,0 +1,264 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+
+
+// default number of paths in a tile, the tile keeps six arrays of doubles (log share price, share price, running sum and
+// the same for the antithetic path) plus the normals, 7 x 256 x 8 bytes = 14 kB, inside a 32 kB L1 cache
+const int default_tile_size{ 256 };
+
+
+// Function declerations
+
+// value Asian call advancing a tile of paths together one step at a time, with antithetic pairs driven by the same tile
+double value_Asian_call_tile(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, const bool& antithetic, const int& tile_size, std::mt19937& rnd, double& standard_error);
+
+// value Asian call keeping only the running log share price and running sum, one path at a time
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, std::mt19937& rnd);
+
+// value Asian call with antithetic variables keeping only the running log share prices and running sums, one pair at a time
+double value_Asian_call_antithetic(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const double& K, std::mt19937& rnd);
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double volatility{ 0.37 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.04 };
+	double initial_share_price{ 900 };
+	double K{ 35 };  // points in the sample path
+	int N{ 1500000 };  // number of MC paths
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("Asian path block.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+	output << "antithetic,tile size,value,standard error,time" << std::endl;
+	std::cout << std::setprecision(8);
+
+	for (int antithetic{ 0 }; antithetic < 2; antithetic++) {
+
+		// one path (or pair) at a time
+		std::mt19937 rnd;
+		auto start = std::chrono::steady_clock::now();  // get start time
+		double scalar_value = antithetic ? value_Asian_call_antithetic(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, rnd)
+			: value_Asian_call(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, rnd);
+		auto finish = std::chrono::steady_clock::now();  // get finish time
+		auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+		double scalar_time = elapsed.count();
+		std::cout << (antithetic ? "antithetic" : "standard") << " one path at a time: V = " << scalar_value << ", time = " << scalar_time << " s" << std::endl;
+		output << antithetic << ",1," << scalar_value << ",0," << scalar_time << std::endl;
+
+		// tiles from inside L1 to beyond L2, the tile draws its normals step by step so the stream differs from the scalar kernel
+		for (int tile_size{ 16 }; tile_size <= 16384; tile_size *= 4) {
+
+			std::mt19937 rnd;
+			double standard_error;
+			start = std::chrono::steady_clock::now();  // get start time
+			double value = value_Asian_call_tile(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, antithetic,
+				tile_size, rnd, standard_error);
+			finish = std::chrono::steady_clock::now();  // get finish time
+			elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+			std::cout << "  tile size " << std::setw(5) << tile_size << ": V = " << value << " +- " << standard_error << ", difference = "
+				<< std::setw(12) << value - scalar_value << ", time = " << elapsed.count() << " s, speed up = " << scalar_time / elapsed.count()
+				<< (tile_size == default_tile_size ? " (default)" : "") << std::endl;
+			output << antithetic << "," << tile_size << "," << value << "," << standard_error << "," << elapsed.count() << std::endl;
+		}
+	}
+	output.close();
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// value Asian call advancing a tile of paths together one step at a time, with antithetic pairs driven by the same tile
+// the tile is held as structure of arrays so every loop over the tile is a straight loop over contiguous doubles with no
+// dependence between paths, which the compiler can turn into full width SIMD exp, multiplies and adds; the antithetic
+// path of each tile entry is the reflection of the first about the drift line, computed in the same loop
+double value_Asian_call_tile(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, const bool& antithetic, const int& tile_size, std::mt19937& rnd, double& standard_error)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+	double log_initial_share_price = log(initial_share_price);
+	int steps = (int)K;
+
+	// the tile, allocated once for the whole run
+	std::vector<double> phi(tile_size), log_share_price(tile_size), share_price(tile_size), A_sum(tile_size);
+	std::vector<double> share_price2(antithetic ? tile_size : 0), A2_sum(antithetic ? tile_size : 0);
+
+	// initalise sums to zero, with antithetic variables a sample is the average of the pair
+	double sum{ 0 }, sum_sq{ 0 };
+
+	// loop over tiles of paths
+	for (int first{ 0 }; first < N; first += tile_size) {
+
+		int size = std::min(tile_size, N - first);
+		for (int i{ 0 }; i < size; i++) {
+			log_share_price[i] = log_initial_share_price;
+			A_sum[i] = 0;
+		}
+		if (antithetic) for (int i{ 0 }; i < size; i++) A2_sum[i] = 0;
+
+		// advance the whole tile one step at a time
+		for (int j{ 0 }; j < steps; j++) {
+
+			// generate random numbers for the tile
+			for (int i{ 0 }; i < size; i++) phi[i] = ND(rnd);
+
+			// step every path in the tile
+			for (int i{ 0 }; i < size; i++) {
+				log_share_price[i] += drift + diffusion * phi[i];
+				share_price[i] = exp(log_share_price[i]);
+				A_sum[i] += share_price[i];
+			}
+
+			// step every antithetic path, S2 = exp(2 (log S0 + (j + 1) drift)) / S1
+			if (antithetic) {
+				double reflection = exp(2 * (log_initial_share_price + (j + 1) * drift));
+				for (int i{ 0 }; i < size; i++) {
+					share_price2[i] = reflection / share_price[i];
+					A2_sum[i] += share_price2[i];
+				}
+			}
+		}
+
+		// add in the payoffs
+		for (int i{ 0 }; i < size; i++) {
+			double payoff = std::max(share_price[i] - A_sum[i] / K, 0.);
+			if (antithetic) payoff = 0.5 * (payoff + std::max(share_price2[i] - A2_sum[i] / K, 0.));
+			sum += payoff;
+			sum_sq += payoff * payoff;
+		}
+	}
+
+	// average over all paths
+	double mean = sum / N;
+	standard_error = exp(-interest_rate * expiration) * sqrt((sum_sq / N - mean * mean) / (N - 1.));
+	return exp(-interest_rate * expiration) * mean;
+}
+
+// value Asian call keeping only the running log share price and running sum, one path at a time
+// the path never needs to be stored, the average only needs the running sum and the payoff only the last share price
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, std::mt19937& rnd)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+	double log_initial_share_price = log(initial_share_price);
+	int steps = (int)K;
+
+	// initalise sum to zero
+	double sum{ 0 };
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		// step the path, accumulating the average as we go
+		double log_share_price = log_initial_share_price;
+		double share_price{ initial_share_price };
+		double A_sum{ 0 };
+		for (int j{ 0 }; j < steps; j++) {
+			log_share_price += drift + diffusion * ND(rnd);
+			share_price = exp(log_share_price);
+			A_sum += share_price;
+		}
+
+		// add in the payoff
+		sum += std::max(share_price - A_sum / K, 0.);
+	}
+
+	// average over all paths
+	return exp(-interest_rate * expiration) * sum / N;
+}
+
+// value Asian call with antithetic variables keeping only the running log share prices and running sums, one pair at a time
+// the antithetic log share price is the reflection of the first about the drift line, log S2 = 2 (log S0 + j drift) - log S1,
+// so S2 = exp(2 (log S0 + j drift)) / S1 costs a division rather than a second exponential
+double value_Asian_call_antithetic(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const double& K, std::mt19937& rnd)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+	double log_initial_share_price = log(initial_share_price);
+	int steps = (int)K;
+
+	// square of the drift line at every step, the same for every path
+	double reflection[1024];
+	int reflection_steps = std::min(steps, 1024);
+	for (int j{ 0 }; j < reflection_steps; j++) reflection[j] = exp(2 * (log_initial_share_price + (j + 1) * drift));
+
+	// initalise sum to zero
+	double sum{ 0 };
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		// step both paths, accumulating the averages as we go
+		double log_share_price = log_initial_share_price;
+		double share_price1{ initial_share_price }, share_price2{ initial_share_price };
+		double A1_sum{ 0 }, A2_sum{ 0 };
+		for (int j{ 0 }; j < steps; j++) {
+			double phi = ND(rnd);
+			log_share_price += drift + diffusion * phi;
+			share_price1 = exp(log_share_price);
+			share_price2 = (j < reflection_steps) ? reflection[j] / share_price1
+				: exp(2 * (log_initial_share_price + (j + 1) * drift) - log_share_price);
+			A1_sum += share_price1;
+			A2_sum += share_price2;
+		}
+
+		// add in the payoff
+		sum += std::max(share_price1 - A1_sum / K, 0.);
+		sum += std::max(share_price2 - A2_sum / K, 0.);
+	}
+
+	// average over all paths
+	return exp(-interest_rate * expiration) * sum / (2.*N);
+}
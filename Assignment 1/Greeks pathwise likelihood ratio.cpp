@@ -0,0 +1,383 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <string>
+
+
+// Function declerations
+
+// perform monte carlo for the value, delta, gamma and vega in a single pass
+void MonteCarlo_Greeks(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, std::vector<double>& estimates, std::vector<double>& standard_errors);
+
+// derivative of the continuous legs of the portfolio payoff with respect to the share price
+double portfolio_payoff_derivative(const int& put_number, const int& call_number, const int& zero_strike_call_number, const double& put_strike,
+	const double& call_strike, const double& share_price);
+
+// payoff of the binary legs of the portfolio
+double portfolio_binary_payoff(const int& binary_put_number, const int& binary_call_number, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price);
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price);
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price);
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price);
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price);
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price);
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate portfolio payoff
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number, 
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike, 
+	const double& binary_call_strike, const double& share_price);
+
+// calculate analytical portfolio value
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+
+// Begin main program
+int main()
+{
+	// constants
+	double expiration{ 0.5 };
+	double volatility{ 0.25 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.01 };
+	double X1{ 450 };
+	double X2{ 700 };
+
+	// portfolio setup
+	int put_number{ 2 };
+	int call_number{ 1 };
+	int binary_put_number{ -700 };
+	int binary_call_number{ 0 };
+	int zero_strike_call_number{ -1 };
+	double put_strike{ X1 };
+	double call_strike{ X2 };
+	double binary_put_strike{ X2 };
+	double binary_call_strike{ 0 };
+
+	int N{ 1000000 };  // number of monte carlo simulations to perform
+
+	// bump sizes for the finite difference check
+	double dS{ 1e-2 };
+	double dsigma{ 1e-4 };
+	double current_time{ 0 };
+
+	// labels for the output
+	std::vector<std::string> labels{ "Pi", "delta", "gamma", "vega" };
+
+	// check both initial share prices
+	std::vector<double> initial_share_prices{ X1, X2 };
+	for (int s{ 0 }; s < initial_share_prices.size(); s++) {
+
+		double initial_share_price = initial_share_prices[s];
+
+		// value and Greeks from a single monte carlo pass
+		std::vector<double> estimates, standard_errors;
+		MonteCarlo_Greeks(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, put_number, call_number, binary_put_number,
+			binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike, estimates, standard_errors);
+
+		// analytic value and finite differences of the analytic value
+		double value = portfolio_analytic(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number,
+			put_strike, call_strike, binary_put_strike, binary_call_strike, initial_share_price, interest_rate, dividend_rate, volatility,
+			expiration, current_time);
+		double value_up = portfolio_analytic(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number,
+			put_strike, call_strike, binary_put_strike, binary_call_strike, initial_share_price + dS, interest_rate, dividend_rate, volatility,
+			expiration, current_time);
+		double value_down = portfolio_analytic(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number,
+			put_strike, call_strike, binary_put_strike, binary_call_strike, initial_share_price - dS, interest_rate, dividend_rate, volatility,
+			expiration, current_time);
+		double value_vol_up = portfolio_analytic(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number,
+			put_strike, call_strike, binary_put_strike, binary_call_strike, initial_share_price, interest_rate, dividend_rate, volatility + dsigma,
+			expiration, current_time);
+		double value_vol_down = portfolio_analytic(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number,
+			put_strike, call_strike, binary_put_strike, binary_call_strike, initial_share_price, interest_rate, dividend_rate, volatility - dsigma,
+			expiration, current_time);
+
+		std::vector<double> finite_difference{ value, (value_up - value_down) / (2 * dS), (value_up - 2 * value + value_down) / pow(dS, 2),
+			(value_vol_up - value_vol_down) / (2 * dsigma) };
+
+		// output results
+		std::cout << "S0 = " << initial_share_price << ", N = " << N << std::endl;
+		for (int i{ 0 }; i < labels.size(); i++) {
+			std::cout << std::setw(6) << labels[i] << ": MC = " << std::setw(14) << estimates[i] << " +/- " << std::setw(12) << standard_errors[i]
+				<< "  analytic FD = " << std::setw(14) << finite_difference[i]
+				<< "  (" << (estimates[i] - finite_difference[i]) / standard_errors[i] << " std errors)" << std::endl;
+		}
+		std::cout << std::endl;
+	}
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// perform monte carlo for the value, delta, gamma and vega in a single pass
+// continuous legs use pathwise derivatives, binary legs use likelihood ratio weights
+void MonteCarlo_Greeks(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, std::vector<double>& estimates, std::vector<double>& standard_errors)
+{
+	// declare random number generator
+	static std::mt19937 rng;
+
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every path
+	double discount = exp(-interest_rate * expiration);
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration;
+	double root_T = pow(expiration, 0.5);
+	double sigma_root_T = volatility * root_T;
+
+	// initialise sums and sums of squares for value, delta, gamma and vega
+	std::vector<double> sum(4, 0.), sum_sq(4, 0.);
+	std::vector<double> sample(4);
+
+	// run the simulations
+	for (int i{ 0 }; i < N; i++) {
+
+		// draw a random normally distributed number
+		double phi = ND(rng);
+
+		// get random value of stock value at maturity
+		double final_share_price = initial_share_price * exp(drift + sigma_root_T * phi);
+
+		// payoff, payoff derivative of the continuous legs and payoff of the binary legs
+		double payoff = portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+			call_strike, binary_put_strike, binary_call_strike, final_share_price);
+		double payoff_derivative = portfolio_payoff_derivative(put_number, call_number, zero_strike_call_number, put_strike, call_strike,
+			final_share_price);
+		double binary_payoff = portfolio_binary_payoff(binary_put_number, binary_call_number, binary_put_strike, binary_call_strike,
+			final_share_price);
+
+		// pathwise sensitivities of S_T
+		double dST_dS0 = final_share_price / initial_share_price;
+		double dST_dsigma = final_share_price * (root_T * phi - volatility * expiration);
+
+		// likelihood ratio weights
+		double delta_weight = phi / (initial_share_price * sigma_root_T);
+		double gamma_weight = (pow(phi, 2) - 1 - sigma_root_T * phi) / (pow(initial_share_price, 2) * pow(sigma_root_T, 2));
+		double vega_weight = (pow(phi, 2) - 1) / volatility - phi * root_T;
+
+		// value, delta, gamma (pathwise on the delta, likelihood ratio on the density) and vega for this path
+		sample[0] = discount * payoff;
+		sample[1] = discount * (payoff_derivative * dST_dS0 + binary_payoff * delta_weight);
+		sample[2] = discount * (payoff_derivative * dST_dS0 / initial_share_price * (phi / sigma_root_T - 1) + binary_payoff * gamma_weight);
+		sample[3] = discount * (payoff_derivative * dST_dsigma + binary_payoff * vega_weight);
+
+		// increment the sums
+		for (int j{ 0 }; j < 4; j++) {
+			sum[j] += sample[j];
+			sum_sq[j] += pow(sample[j], 2);
+		}
+	}
+
+	// output averages and standard errors over all paths
+	estimates.assign(4, 0.);
+	standard_errors.assign(4, 0.);
+	for (int j{ 0 }; j < 4; j++) {
+		estimates[j] = sum[j] / N;
+		standard_errors[j] = sqrt((sum_sq[j] / N - pow(estimates[j], 2)) / (N - 1.));
+	}
+}
+
+// derivative of the continuous legs of the portfolio payoff with respect to the share price
+double portfolio_payoff_derivative(const int& put_number, const int& call_number, const int& zero_strike_call_number, const double& put_strike,
+	const double& call_strike, const double& share_price)
+{
+	double derivative = zero_strike_call_number;
+	if (share_price < put_strike) derivative -= put_number;
+	if (share_price > call_strike) derivative += call_number;
+	return derivative;
+}
+
+// payoff of the binary legs of the portfolio
+double portfolio_binary_payoff(const int& binary_put_number, const int& binary_call_number, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price)
+{
+	return binary_put_number * payoff_binary_put(share_price, binary_put_strike) + binary_call_number * payoff_binary_call(share_price, binary_call_strike);
+}
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return (log(share_price / strike_price) + (interest_rate - divident_rate + pow(volatility, 2) / 2) * (expiration - time)) / (volatility * pow(expiration - time, 0.5));
+}
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time) - volatility * pow(expiration - time, 0.5);
+}
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price) 
+{
+	return std::max(strike_price - share_price, 0.);
+}
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+
+	return strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val) - share_price * exp(-dividend_rate * (expiration - time)) * norm_cumm(-d1_val);
+}
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price) 
+{
+	return std::max(share_price - strike_price, 0.);
+}
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return share_price * exp(-divident_rate * (expiration - time)) * norm_cumm(d1_val) - strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 1;
+	else return 0;
+}
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val);
+}
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 0;
+	else return 1;
+}
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price) 
+{
+	return share_price;
+}
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return share_price * exp(-divident_rate * (expiration - time));
+}
+
+// calculate portfolio value
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price)
+{
+	return put_number * payoff_put(share_price, put_strike) + call_number * payoff_call(share_price, call_strike) +
+		binary_put_number * payoff_binary_put(share_price, binary_put_strike) + binary_call_number * payoff_binary_call(share_price, binary_call_strike) +
+		zero_strike_call_number * payoff_zero_strike_call(share_price);
+}
+
+// calculate analystical portfolio
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return put_number * analytic_put(share_price, put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		call_number * analytic_call(share_price, call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_put_number * analytic_binary_put(share_price, binary_put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_call_number * analytic_binary_call(share_price, binary_call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		zero_strike_call_number * analytic_zero_strike_call(share_price, interest_rate, divident_rate, volatility, expiration, time);
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x) 
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
@@ -0,0 +1,574 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <complex>
+
+
+// number of paths generated and stepped together
+const int path_tile{ 256 };
+
+
+// exact GBM step of the log share price, the variance is the constant sigma^2
+class GBM_kernel
+{
+public:
+	static const int normals_per_step{ 1 };
+	GBM_kernel(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+		const double& expiration, const int& K);
+	int steps() const { return K; }
+	void start(double* log_share_prices, double* variances, const int& P) const;
+	void step(double* log_share_prices, double* variances, const double* normals, const int& P) const;
+private:
+	int K;
+	double log_initial, variance, drift, diffusion;
+};
+
+// Heston model stepped by Andersen's quadratic exponential (QE) scheme, every constant of a step is computed once
+class Heston_QE_kernel
+{
+public:
+	static const int normals_per_step{ 2 };
+	Heston_QE_kernel(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& initial_variance,
+		const double& mean_reversion, const double& long_run_variance, const double& vol_of_vol, const double& correlation,
+		const double& expiration, const int& K);
+	int steps() const { return K; }
+	void start(double* log_share_prices, double* variances, const int& P) const;
+	void step(double* log_share_prices, double* variances, const double* normals, const int& P) const;
+private:
+	int K;
+	double log_initial, initial_variance, long_run_variance, drift;
+	double decay, m_constant, s2_old, s2_constant;  // moments of the next variance
+	double K0, K1, K2, K3, K4;  // log share price step
+};
+
+
+// Function declerations
+
+// perform monte carlo on the portfolio with the share price paths of any kernel
+template <typename model>
+double MonteCarlo(const model& paths, const double& interest_rate, const double& expiration, const int& N, const int& put_number,
+	const int& call_number, const int& binary_put_number, const int& binary_call_number, const int& zero_strike_call_number,
+	const double& put_strike, const double& call_strike, const double& binary_put_strike, const double& binary_call_strike,
+	const unsigned int& seed, double& standard_error);
+
+// value Asian call with the share price paths of any kernel
+template <typename model>
+double value_Asian_call(const model& paths, const double& interest_rate, const double& expiration, const int& N, const unsigned int& seed,
+	double& standard_error);
+
+// semi-analytic Heston call, to check the QE kernel
+double analytic_Heston_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& dividend_rate,
+	const double& initial_variance, const double& mean_reversion, const double& long_run_variance, const double& vol_of_vol,
+	const double& correlation, const double& expiration);
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price);
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price);
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price);
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price);
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price);
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate portfolio payoff
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number, 
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike, 
+	const double& binary_call_strike, const double& share_price);
+
+// calculate analytical portfolio value
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+// Begin main program
+int main()
+{
+	std::cout << std::setprecision(6);
+	unsigned int seed{ 20210318 };
+
+	// QE against the semi-analytic price of an at the money call on the Asian parameters
+	{
+		double expiration{ 1.25 };
+		double interest_rate{ 0.03 };
+		double dividend_rate{ 0.04 };
+		double initial_share_price{ 900 };
+		double v0{ pow(0.37, 2) }, kappa{ 2 }, theta{ pow(0.37, 2) }, xi{ 0.5 }, rho{ -0.6 };
+
+		double analytic = analytic_Heston_call(initial_share_price, 900, interest_rate, dividend_rate, v0, kappa, theta, xi, rho, expiration);
+		for (int K : { 4, 16, 35 }) {
+			Heston_QE_kernel Heston(initial_share_price, interest_rate, dividend_rate, v0, kappa, theta, xi, rho, expiration, K);
+			double standard_error;
+			double value = MonteCarlo(Heston, interest_rate, expiration, 1000000, 0, 1, 0, 0, 0, 0., 900., 0., 0., seed, standard_error);
+			std::cout << "Heston call, QE with K = " << std::setw(2) << K << ": MC = " << value << " +- " << standard_error << ", analytic = " << analytic
+				<< ", standard errors = " << (value - analytic) / standard_error << std::endl;
+		}
+	}
+
+	// the portfolio under GBM and Heston with the same variance
+	{
+		double expiration{ 0.5 };
+		double volatility{ 0.25 };
+		double interest_rate{ 0.03 };
+		double dividend_rate{ 0.01 };
+		double X1{ 450 };
+		double X2{ 700 };
+
+		// portfolio setup
+		int put_number{ 2 };
+		int call_number{ 1 };
+		int binary_put_number{ -700 };
+		int binary_call_number{ 0 };
+		int zero_strike_call_number{ -1 };
+		double put_strike{ X1 };
+		double call_strike{ X2 };
+		double binary_put_strike{ X2 };
+		double binary_call_strike{ 0 };
+		double initial_share_price{ X2 };
+		int N{ 1000000 };
+
+		GBM_kernel GBM(initial_share_price, interest_rate, dividend_rate, volatility, expiration, 1);
+		Heston_QE_kernel Heston(initial_share_price, interest_rate, dividend_rate, pow(volatility, 2), 2, pow(volatility, 2), 0.5, -0.6, expiration, 20);
+		double GBM_error, Heston_error;
+		double GBM_value = MonteCarlo(GBM, interest_rate, expiration, N, put_number, call_number, binary_put_number, binary_call_number,
+			zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike, seed, GBM_error);
+		double Heston_value = MonteCarlo(Heston, interest_rate, expiration, N, put_number, call_number, binary_put_number, binary_call_number,
+			zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike, seed, Heston_error);
+		double analytic = portfolio_analytic(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+			call_strike, binary_put_strike, binary_call_strike, initial_share_price, interest_rate, dividend_rate, volatility, expiration, 0);
+		std::cout << "portfolio: GBM = " << GBM_value << " +- " << GBM_error << " (analytic " << analytic << "), Heston = " << Heston_value << " +- "
+			<< Heston_error << std::endl;
+	}
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("Heston path kernel.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+	output << "model,value,standard error,time,path steps per second" << std::endl;
+
+	// the Asian call under both kernels, throughput in path steps per second
+	{
+		double expiration{ 1.25 };
+		double volatility{ 0.37 };
+		double interest_rate{ 0.03 };
+		double dividend_rate{ 0.04 };
+		double initial_share_price{ 900 };
+		int K{ 35 };  // points in the sample path
+		int N{ 500000 };  // number of MC paths
+
+		GBM_kernel GBM(initial_share_price, interest_rate, dividend_rate, volatility, expiration, K);
+		Heston_QE_kernel Heston(initial_share_price, interest_rate, dividend_rate, pow(volatility, 2), 2, pow(volatility, 2), 0.5, -0.6, expiration, K);
+
+		for (int m{ 0 }; m < 2; m++) {
+			double standard_error;
+			auto start = std::chrono::steady_clock::now();  // get start time
+			double value = (m == 0) ? value_Asian_call(GBM, interest_rate, expiration, N, seed, standard_error)
+				: value_Asian_call(Heston, interest_rate, expiration, N, seed, standard_error);
+			auto finish = std::chrono::steady_clock::now();  // get finish time
+			auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+			const char* name = (m == 0) ? "GBM" : "Heston QE";
+			double throughput = (double)N * K / elapsed.count();
+			std::cout << "Asian call, " << std::setw(9) << name << ": V = " << value << " +- " << standard_error << ", time = " << elapsed.count()
+				<< " s, path steps per second = " << throughput << std::endl;
+			output << name << "," << value << "," << standard_error << "," << elapsed.count() << "," << throughput << std::endl;
+		}
+	}
+	output.close();
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// exact GBM step of the log share price, the variance is the constant sigma^2
+GBM_kernel::GBM_kernel(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& K) : K(K)
+{
+	double dt{ expiration / K };
+	log_initial = log(initial_share_price);
+	variance = pow(volatility, 2);
+	drift = (interest_rate - dividend_rate - 0.5 * variance) * dt;
+	diffusion = volatility * pow(dt, 0.5);
+}
+
+void GBM_kernel::start(double* log_share_prices, double* variances, const int& P) const
+{
+	for (int p{ 0 }; p < P; p++) {
+		log_share_prices[p] = log_initial;
+		variances[p] = variance;
+	}
+}
+
+void GBM_kernel::step(double* log_share_prices, double* variances, const double* normals, const int& P) const
+{
+	for (int p{ 0 }; p < P; p++) log_share_prices[p] += drift + diffusion * normals[p];
+}
+
+// Heston model stepped by Andersen's quadratic exponential (QE) scheme
+// with E = e^(-kappa dt) the next variance has mean m = theta + (v - theta) E and variance s^2 = v s2_old + s2_constant, and
+// the log share price uses the central discretisation (gamma_1 = gamma_2 = 1/2) of the integrated variance
+Heston_QE_kernel::Heston_QE_kernel(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& initial_variance, const double& mean_reversion, const double& long_run_variance, const double& vol_of_vol,
+	const double& correlation, const double& expiration, const int& K)
+	: K(K), initial_variance(initial_variance), long_run_variance(long_run_variance)
+{
+	double dt{ expiration / K };
+	log_initial = log(initial_share_price);
+	drift = (interest_rate - dividend_rate) * dt;
+
+	decay = exp(-mean_reversion * dt);
+	m_constant = long_run_variance * (1 - decay);
+	s2_old = pow(vol_of_vol, 2) * decay * (1 - decay) / mean_reversion;
+	s2_constant = long_run_variance * pow(vol_of_vol, 2) * pow(1 - decay, 2) / (2 * mean_reversion);
+
+	double gamma{ 0.5 };
+	K0 = -correlation * mean_reversion * long_run_variance * dt / vol_of_vol;
+	K1 = gamma * dt * (mean_reversion * correlation / vol_of_vol - 0.5) - correlation / vol_of_vol;
+	K2 = gamma * dt * (mean_reversion * correlation / vol_of_vol - 0.5) + correlation / vol_of_vol;
+	K3 = gamma * dt * (1 - pow(correlation, 2));
+	K4 = K3;
+}
+
+void Heston_QE_kernel::start(double* log_share_prices, double* variances, const int& P) const
+{
+	for (int p{ 0 }; p < P; p++) {
+		log_share_prices[p] = log_initial;
+		variances[p] = initial_variance;
+	}
+}
+
+// normals holds P normals for the variance followed by P for the share price; the quadratic branch is used for psi <= 1.5 and the
+// exponential branch takes its uniform from the variance normal, so every path uses two normals a step whichever branch it takes
+void Heston_QE_kernel::step(double* log_share_prices, double* variances, const double* normals, const int& P) const
+{
+	const double* Z_v = normals;
+	const double* Z = normals + P;
+	for (int p{ 0 }; p < P; p++) {
+		double v = variances[p];
+		double m = m_constant + v * decay;
+		double s2 = v * s2_old + s2_constant;
+		double psi = s2 / (m * m);
+
+		double v_next;
+		if (psi <= 1.5) {
+			double b2 = 2 / psi - 1 + sqrt(2 / psi) * sqrt(2 / psi - 1);
+			double a = m / (1 + b2);
+			v_next = a * pow(sqrt(b2) + Z_v[p], 2);
+		}
+		else {
+			double prob = (psi - 1) / (psi + 1);
+			double beta = (1 - prob) / m;
+			double U = 0.5 * erfc(-Z_v[p] / M_SQRT2);
+			v_next = (U <= prob) ? 0 : log((1 - prob) / (1 - U)) / beta;
+		}
+
+		log_share_prices[p] += drift + K0 + K1 * v + K2 * v_next + sqrt(K3 * v + K4 * v_next) * Z[p];
+		variances[p] = v_next;
+	}
+}
+
+// perform monte carlo on the portfolio with the share price paths of any kernel
+// paths are stepped a tile at a time with the normals of a step drawn for the whole tile first
+template <typename model>
+double MonteCarlo(const model& paths, const double& interest_rate, const double& expiration, const int& N, const int& put_number,
+	const int& call_number, const int& binary_put_number, const int& binary_call_number, const int& zero_strike_call_number,
+	const double& put_strike, const double& call_strike, const double& binary_put_strike, const double& binary_call_strike,
+	const unsigned int& seed, double& standard_error)
+{
+	// declare random number generator
+	std::mt19937 rnd(seed);
+	std::normal_distribution<double> ND(0., 1.);
+
+	// the tile
+	std::vector<double> log_share_prices(path_tile), variances(path_tile), normals(model::normals_per_step * path_tile);
+
+	// initialise sums to 0
+	double sum{ 0 }, sum_sq{ 0 };
+
+	for (int first{ 0 }; first < N; first += path_tile) {
+		int P = std::min(path_tile, N - first);
+		paths.start(log_share_prices.data(), variances.data(), P);
+		for (int j{ 0 }; j < paths.steps(); j++) {
+			for (int n{ 0 }; n < model::normals_per_step * P; n++) normals[n] = ND(rnd);
+			paths.step(log_share_prices.data(), variances.data(), normals.data(), P);
+		}
+
+		// increment the sum
+		for (int p{ 0 }; p < P; p++) {
+			double payoff = portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+				call_strike, binary_put_strike, binary_call_strike, exp(log_share_prices[p]));
+			sum += payoff;
+			sum_sq += payoff * payoff;
+		}
+	}
+
+	// output average over all paths
+	double mean = sum / N;
+	standard_error = exp(-interest_rate * expiration) * sqrt((sum_sq / N - mean * mean) / (N - 1.));
+	return exp(-interest_rate * expiration) * mean;
+}
+
+// value Asian call with the share price paths of any kernel
+template <typename model>
+double value_Asian_call(const model& paths, const double& interest_rate, const double& expiration, const int& N, const unsigned int& seed,
+	double& standard_error)
+{
+	// declare random number generator
+	std::mt19937 rnd(seed);
+	std::normal_distribution<double> ND(0., 1.);
+
+	// the tile
+	std::vector<double> log_share_prices(path_tile), variances(path_tile), normals(model::normals_per_step * path_tile), A_sums(path_tile);
+	int K = paths.steps();
+
+	// initalise sums to zero
+	double sum{ 0 }, sum_sq{ 0 };
+
+	for (int first{ 0 }; first < N; first += path_tile) {
+		int P = std::min(path_tile, N - first);
+		paths.start(log_share_prices.data(), variances.data(), P);
+		std::fill(A_sums.begin(), A_sums.end(), 0.);
+		for (int j{ 0 }; j < K; j++) {
+			for (int n{ 0 }; n < model::normals_per_step * P; n++) normals[n] = ND(rnd);
+			paths.step(log_share_prices.data(), variances.data(), normals.data(), P);
+			for (int p{ 0 }; p < P; p++) A_sums[p] += exp(log_share_prices[p]);
+		}
+
+		// add in the payoffs
+		for (int p{ 0 }; p < P; p++) {
+			double payoff = std::max(exp(log_share_prices[p]) - A_sums[p] / K, 0.);
+			sum += payoff;
+			sum_sq += payoff * payoff;
+		}
+	}
+
+	// average over all paths
+	double mean = sum / N;
+	standard_error = exp(-interest_rate * expiration) * sqrt((sum_sq / N - mean * mean) / (N - 1.));
+	return exp(-interest_rate * expiration) * mean;
+}
+
+// semi-analytic Heston call, to check the QE kernel
+// C = S e^(-qT) P1 - X e^(-rT) P2 with P_j = 1/2 + (1 / pi) int_0^inf Re(e^(-iu log X) f_j(u) / (iu)) du, f_2 = phi(u) and
+// f_1 = phi(u - i) / phi(-i) for the characteristic function phi of log S_T in the "little trap" form of Albrecher et al.;
+// the integral is by Simpson's rule on (0, 200]
+double analytic_Heston_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& dividend_rate,
+	const double& initial_variance, const double& mean_reversion, const double& long_run_variance, const double& vol_of_vol,
+	const double& correlation, const double& expiration)
+{
+	typedef std::complex<double> complex;
+	const complex i(0, 1);
+	double forward = share_price * exp((interest_rate - dividend_rate) * expiration);
+
+	auto phi = [&](const complex& u) {
+		complex beta = mean_reversion - correlation * vol_of_vol * i * u;
+		complex d = sqrt(beta * beta + pow(vol_of_vol, 2) * (i * u + u * u));
+		complex g = (beta - d) / (beta + d);
+		complex e = exp(-d * expiration);
+		complex C = mean_reversion * long_run_variance / pow(vol_of_vol, 2) * ((beta - d) * expiration - 2. * log((1. - g * e) / (1. - g)));
+		complex D = (beta - d) / pow(vol_of_vol, 2) * (1. - e) / (1. - g * e);
+		return exp(i * u * log(forward) + C + D * initial_variance);
+	};
+
+	int intervals{ 4000 };
+	double upper{ 200 }, h = upper / intervals;
+	double P1{ 0 }, P2{ 0 };
+	for (int k{ 1 }; k <= intervals; k++) {
+		double u = k * h;
+		double weight = (k == intervals) ? 1 : (k % 2 == 1 ? 4 : 2);
+		complex kernel = exp(-i * u * log(strike_price)) / (i * u);
+		P1 += weight * real(kernel * phi(u - i) / forward);
+		P2 += weight * real(kernel * phi(u));
+	}
+	// the integrands are finite at u = 0, the missing first Simpson point is approximated by the second
+	double u = h;
+	complex kernel = exp(-i * u * log(strike_price)) / (i * u);
+	P1 += real(kernel * phi(u - i) / forward);
+	P2 += real(kernel * phi(u));
+	P1 = 0.5 + P1 * h / (3 * M_PI);
+	P2 = 0.5 + P2 * h / (3 * M_PI);
+
+	return share_price * exp(-dividend_rate * expiration) * P1 - strike_price * exp(-interest_rate * expiration) * P2;
+}
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return (log(share_price / strike_price) + (interest_rate - divident_rate + pow(volatility, 2) / 2) * (expiration - time)) / (volatility * pow(expiration - time, 0.5));
+}
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time) - volatility * pow(expiration - time, 0.5);
+}
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price) 
+{
+	return std::max(strike_price - share_price, 0.);
+}
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+
+	return strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val) - share_price * exp(-dividend_rate * (expiration - time)) * norm_cumm(-d1_val);
+}
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price) 
+{
+	return std::max(share_price - strike_price, 0.);
+}
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return share_price * exp(-divident_rate * (expiration - time)) * norm_cumm(d1_val) - strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 1;
+	else return 0;
+}
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val);
+}
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 0;
+	else return 1;
+}
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price) 
+{
+	return share_price;
+}
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return share_price * exp(-divident_rate * (expiration - time));
+}
+
+// calculate portfolio value
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price)
+{
+	return put_number * payoff_put(share_price, put_strike) + call_number * payoff_call(share_price, call_strike) +
+		binary_put_number * payoff_binary_put(share_price, binary_put_strike) + binary_call_number * payoff_binary_call(share_price, binary_call_strike) +
+		zero_strike_call_number * payoff_zero_strike_call(share_price);
+}
+
+// calculate analystical portfolio
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return put_number * analytic_put(share_price, put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		call_number * analytic_call(share_price, call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_put_number * analytic_binary_put(share_price, binary_put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_call_number * analytic_binary_call(share_price, binary_call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		zero_strike_call_number * analytic_zero_strike_call(share_price, interest_rate, divident_rate, volatility, expiration, time);
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x) 
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
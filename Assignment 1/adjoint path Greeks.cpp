@@ -0,0 +1,272 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <string>
+
+
+// products priced by the path kernel
+const std::vector<std::string> product_names{ "floating strike Asian call", "up and out call (bridge)" };
+const std::vector<std::string> estimate_names{ "value", "delta", "vega", "rho", "dividend" };
+
+
+// Function declerations
+
+// value a path dependent product by monte carlo
+double value_path(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const int& product, const double& strike_price, const double& barrier,
+	const unsigned int& seed);
+
+// value a path dependent product and its delta, vega, rho and dividend sensitivity with a pathwise adjoint
+void value_path_Greeks(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const int& product, const double& strike_price, const double& barrier,
+	const unsigned int& seed, std::vector<double>& estimates, std::vector<double>& standard_errors);
+
+// payoff of a path given its log share prices x_0 ... x_K, and with adjoint true the payoff derivative with respect to each x_j
+// and to the volatility where it enters the payoff directly
+double path_payoff(const std::vector<double>& log_share_prices, const int& K, const int& product, const double& strike_price, const double& barrier,
+	const double& volatility, const double& dt, const bool& adjoint, std::vector<double>& log_share_prices_bar, double& volatility_bar);
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double volatility{ 0.37 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.04 };
+	double initial_share_price{ 900 };
+	double strike_price{ 900 };
+	double barrier{ 1400 };
+	int K{ 35 };  // points in the sample path
+	int N{ 200000 };  // number of MC paths
+	unsigned int seed{ 20210318 };
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("adjoint path Greeks.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+	std::cout << std::setprecision(6);
+
+	for (int product{ 0 }; product < product_names.size(); product++) {
+
+		// pricing only
+		auto start = std::chrono::steady_clock::now();  // get start time
+		double value = value_path(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, product, strike_price, barrier, seed);
+		auto finish = std::chrono::steady_clock::now();  // get finish time
+		double price_time = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start).count();
+
+		// value and every Greek from one adjoint run
+		std::vector<double> estimates, standard_errors;
+		start = std::chrono::steady_clock::now();  // get start time
+		value_path_Greeks(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, product, strike_price, barrier, seed,
+			estimates, standard_errors);
+		finish = std::chrono::steady_clock::now();  // get finish time
+		double adjoint_time = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start).count();
+
+		// central differences with common random numbers, two runs per Greek
+		std::vector<double> bumped(5, value);
+		std::vector<double> bump_sizes{ 0, 1e-3 * initial_share_price, 1e-4, 1e-4, 1e-4 };
+		start = std::chrono::steady_clock::now();  // get start time
+		for (int g{ 1 }; g < 5; g++) {
+			std::vector<double> up{ initial_share_price, volatility, interest_rate, dividend_rate }, down = up;
+			up[g - 1] += bump_sizes[g];
+			down[g - 1] -= bump_sizes[g];
+			double value_up = value_path(up[0], up[2], up[3], up[1], expiration, N, K, product, strike_price, barrier, seed);
+			double value_down = value_path(down[0], down[2], down[3], down[1], expiration, N, K, product, strike_price, barrier, seed);
+			bumped[g] = (value_up - value_down) / (2 * bump_sizes[g]);
+		}
+		finish = std::chrono::steady_clock::now();  // get finish time
+		double bump_time = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start).count() + price_time;
+
+		std::cout << product_names[product] << std::endl;
+		for (int g{ 0 }; g < 5; g++) {
+			std::cout << "  " << std::setw(9) << estimate_names[g] << ": adjoint = " << std::setw(11) << estimates[g] << " +- " << std::setw(9)
+				<< standard_errors[g] << ", bump = " << std::setw(11) << bumped[g] << std::endl;
+			output << product_names[product] << "," << estimate_names[g] << "," << estimates[g] << "," << standard_errors[g] << "," << bumped[g] << std::endl;
+		}
+		std::cout << "  pricing time = " << price_time << " s, adjoint time = " << adjoint_time << " s (" << adjoint_time / price_time
+			<< " x pricing), bump time = " << bump_time << " s (" << bump_time / price_time << " x pricing)" << std::endl;
+	}
+	output.close();
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// value a path dependent product by monte carlo
+double value_path(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const int& product, const double& strike_price, const double& barrier,
+	const unsigned int& seed)
+{
+	// declare random number generator
+	std::mt19937 rnd(seed);
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+
+	// the path, reused for every path
+	std::vector<double> log_share_prices(K + 1), unused;
+	double unused_bar;
+
+	// initalise sum to zero
+	double sum{ 0 };
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		log_share_prices[0] = log(initial_share_price);
+		for (int j{ 1 }; j <= K; j++) log_share_prices[j] = log_share_prices[j - 1] + drift + diffusion * ND(rnd);
+
+		sum += path_payoff(log_share_prices, K, product, strike_price, barrier, volatility, dt, false, unused, unused_bar);
+	}
+
+	// average over all paths
+	return exp(-interest_rate * expiration) * sum / N;
+}
+
+// value a path dependent product and its delta, vega, rho and dividend sensitivity with a pathwise adjoint
+// the forward sweep records the normals and log share prices of one path, the payoff adjoint gives xbar_j = dP / dx_j, and the
+// reverse sweep through x_j = x_(j-1) + (r - q - sigma^2 / 2) dt + sigma sqrt(dt) z_j carries a = sum_(i >= j) xbar_i back to
+// x_0 = log S0, picking up rbar += a dt, qbar -= a dt and sigmabar += a (sqrt(dt) z_j - sigma dt) on the way; the tape is the
+// O(K) path of the current path only, reused for every path
+void value_path_Greeks(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const int& product, const double& strike_price, const double& barrier,
+	const unsigned int& seed, std::vector<double>& estimates, std::vector<double>& standard_errors)
+{
+	// declare random number generator
+	std::mt19937 rnd(seed);
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double root_dt = pow(dt, 0.5);
+	double discount = exp(-interest_rate * expiration);
+
+	// the tape of one path
+	std::vector<double> normals(K + 1), log_share_prices(K + 1), log_share_prices_bar(K + 1);
+
+	// initalise sums to zero
+	std::vector<double> sums(5, 0.), sums_sq(5, 0.);
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		// forward sweep
+		log_share_prices[0] = log(initial_share_price);
+		for (int j{ 1 }; j <= K; j++) {
+			normals[j] = ND(rnd);
+			log_share_prices[j] = log_share_prices[j - 1] + drift + volatility * root_dt * normals[j];
+		}
+		double volatility_bar{ 0 };
+		double payoff = path_payoff(log_share_prices, K, product, strike_price, barrier, volatility, dt, true, log_share_prices_bar, volatility_bar);
+
+		// reverse sweep
+		double a{ 0 }, interest_rate_bar{ 0 }, dividend_rate_bar{ 0 };
+		for (int j{ K }; j >= 1; j--) {
+			a += log_share_prices_bar[j];
+			interest_rate_bar += a * dt;
+			dividend_rate_bar -= a * dt;
+			volatility_bar += a * (root_dt * normals[j] - volatility * dt);
+		}
+		a += log_share_prices_bar[0];
+
+		// discounted estimates, the discount factor also depends on r
+		std::vector<double> path_estimates{ discount * payoff, discount * a / initial_share_price, discount * volatility_bar,
+			discount * (interest_rate_bar - expiration * payoff), discount * dividend_rate_bar };
+		for (int g{ 0 }; g < 5; g++) {
+			sums[g] += path_estimates[g];
+			sums_sq[g] += path_estimates[g] * path_estimates[g];
+		}
+	}
+
+	// average over all paths
+	estimates = std::vector<double>(5);
+	standard_errors = std::vector<double>(5);
+	for (int g{ 0 }; g < 5; g++) {
+		estimates[g] = sums[g] / N;
+		standard_errors[g] = pow((sums_sq[g] / N - estimates[g] * estimates[g]) / (N - 1.), 0.5);
+	}
+}
+
+// payoff of a path given its log share prices x_0 ... x_K, and with adjoint true the payoff derivative with respect to each x_j
+// and to the volatility where it enters the payoff directly
+double path_payoff(const std::vector<double>& log_share_prices, const int& K, const int& product, const double& strike_price, const double& barrier,
+	const double& volatility, const double& dt, const bool& adjoint, std::vector<double>& log_share_prices_bar, double& volatility_bar)
+{
+	if (adjoint) std::fill(log_share_prices_bar.begin(), log_share_prices_bar.end(), 0.);
+	double share_price = exp(log_share_prices[K]);
+
+	// floating strike Asian call max(S_K - A, 0), A the average of S_1 ... S_K
+	if (product == 0) {
+		double A_sum{ 0 };
+		for (int j{ 1 }; j <= K; j++) A_sum += exp(log_share_prices[j]);
+		double payoff = share_price - A_sum / K;
+		if (payoff <= 0) return 0;
+
+		// dP / dx_j = S_j dP / dS_j
+		if (adjoint) {
+			for (int j{ 1 }; j <= K; j++) log_share_prices_bar[j] = -exp(log_share_prices[j]) / K;
+			log_share_prices_bar[K] += share_price;
+		}
+		return payoff;
+	}
+
+	// up and out call weighted by the probability of not crossing the barrier inside any step (Brownian bridge),
+	// p_j = exp(-2 (h - x_(j-1))(h - x_j) / (sigma^2 dt)) and P = prod (1 - p_j) max(S_K - X, 0)
+	double log_barrier = log(barrier);
+	double variance_step = pow(volatility, 2) * dt;
+	double call = std::max(share_price - strike_price, 0.);
+	if (call == 0) return 0;
+	double survival{ 1 };
+	for (int j{ 0 }; j <= K; j++) if (log_share_prices[j] >= log_barrier) return 0;
+	for (int j{ 1 }; j <= K; j++) {
+		survival *= -expm1(-2 * (log_barrier - log_share_prices[j - 1]) * (log_barrier - log_share_prices[j]) / variance_step);
+	}
+	double payoff = survival * call;
+
+	// a point within rounding distance of the barrier makes 1 - p_j and so the payoff 0, and its derivatives are 0 as well
+	if (payoff == 0) return 0;
+
+	// d log(1 - p_j) = -p_j / (1 - p_j) d log p_j, with d log p_j / dx_(j-1) = 2 (h - x_j) / (sigma^2 dt), d log p_j / dx_j = 2 (h - x_(j-1)) / (sigma^2 dt)
+	// and d log p_j / d sigma = 4 (h - x_(j-1))(h - x_j) / (sigma^3 dt), p_j / (1 - p_j) is worked out as 1 / expm1(-log p_j) so it has no 0 / 0
+	if (adjoint) {
+		for (int j{ 1 }; j <= K; j++) {
+			double left = log_barrier - log_share_prices[j - 1], right = log_barrier - log_share_prices[j];
+			double weight = -payoff / expm1(2 * left * right / variance_step);
+			log_share_prices_bar[j - 1] += weight * 2 * right / variance_step;
+			log_share_prices_bar[j] += weight * 2 * left / variance_step;
+			volatility_bar += weight * 4 * left * right / (variance_step * volatility);
+		}
+		log_share_prices_bar[K] += survival * share_price;
+	}
+	return payoff;
+}
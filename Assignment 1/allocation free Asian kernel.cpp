@@ -0,0 +1,349 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+
+// number of heap allocations made by the program, counted by the global operator new below
+static long long allocation_count{ 0 };
+
+
+// Function declerations
+
+// value Asian call, the original kernel storing every path in a vector
+double value_Asian_call_vector(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, std::mt19937& rnd);
+
+// value Asian call with antithetic variables, the original kernel storing both paths in vectors
+double value_Asian_call_antithetic_vector(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const double& K, std::mt19937& rnd);
+
+// value Asian call keeping only the running log share price and running sum
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, std::mt19937& rnd);
+
+// value Asian call with antithetic variables keeping only the running log share prices and running sums
+double value_Asian_call_antithetic(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const double& K, std::mt19937& rnd);
+
+// time to draw the normals alone, the floor for any kernel using this generator
+double time_normals(const int& count, std::mt19937& rnd, double& sum);
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double volatility{ 0.37 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.04 };
+	double initial_share_price{ 900 };
+	double K{ 35 };  // points in the sample path
+	int N{ 1500000 };  // number of MC paths
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("allocation free Asian kernel.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+	output << "kernel,value,time,allocations" << std::endl;
+
+	// kernels in pairs of the vector kernel and the allocation free kernel
+	std::vector<std::string> names{ "vector", "running sum", "antithetic vector", "antithetic running sum" };
+	std::vector<double> values, times;
+	std::vector<long long> allocations;
+	values.reserve(names.size());
+	times.reserve(names.size());
+	allocations.reserve(names.size());
+	for (int kernel{ 0 }; kernel < names.size(); kernel++) {
+
+		// every kernel starts from the same generator state
+		std::mt19937 rnd;
+		long long allocations_before = allocation_count;
+		auto start = std::chrono::steady_clock::now();  // get start time
+		double value;
+		switch (kernel) {
+		case 0: value = value_Asian_call_vector(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, rnd); break;
+		case 1: value = value_Asian_call(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, rnd); break;
+		case 2: value = value_Asian_call_antithetic_vector(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, rnd); break;
+		default: value = value_Asian_call_antithetic(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, rnd); break;
+		}
+		auto finish = std::chrono::steady_clock::now();  // get finish time
+		auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+		allocations.push_back(allocation_count - allocations_before);
+		values.push_back(value);
+		times.push_back(elapsed.count());
+	}
+
+	// the normals alone
+	std::mt19937 rnd;
+	double normals_sum;
+	double normals_time = time_normals(N * (int)K, rnd, normals_sum);
+
+	// report, the running sum kernels see the same normals so agree with the vector kernels to rounding
+	std::cout << std::setprecision(10);
+	for (int kernel{ 0 }; kernel < names.size(); kernel++) {
+		std::cout << std::setw(24) << names[kernel] << ": V = " << values[kernel] << ", time = " << times[kernel] << " s, allocations = "
+			<< allocations[kernel] << ", allocations per path = " << double(allocations[kernel]) / N;
+		if (kernel % 2 == 1) {
+			std::cout << ", speed up = " << times[kernel - 1] / times[kernel] << ", speed up excluding normals = "
+				<< (times[kernel - 1] - normals_time) / (times[kernel] - normals_time) << ", difference = " << values[kernel] - values[kernel - 1];
+		}
+		std::cout << std::endl;
+		output << names[kernel] << "," << values[kernel] << "," << times[kernel] << "," << allocations[kernel] << std::endl;
+	}
+	std::cout << std::setw(24) << "normals only" << ": time = " << normals_time << " s" << std::endl;
+	output.close();
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// count every heap allocation
+void* operator new(std::size_t size)
+{
+	allocation_count++;
+	if (void* pointer = std::malloc(size == 0 ? 1 : size)) return pointer;
+	throw std::bad_alloc();
+}
+
+// release memory from the counting operator new
+void operator delete(void* pointer) noexcept
+{
+	std::free(pointer);
+}
+
+// release memory from the counting operator new
+void operator delete(void* pointer, std::size_t size) noexcept
+{
+	std::free(pointer);
+}
+
+// value Asian call, the original kernel storing every path in a vector
+double value_Asian_call_vector(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, std::mt19937& rnd)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// initalise sum to zero
+	double sum{ 0 };
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		// create a sample path
+		double dt{ expiration / K };
+		std::vector<double> stock_path;
+		stock_path.push_back(initial_share_price);
+		for (int i{ 1 }; i <= K; i++) {
+
+			// generate random number
+			double phi = ND(rnd);
+
+			// gemerate stock path
+			stock_path.push_back(stock_path[i - 1] * exp((interest_rate - dividend_rate -
+				0.5 * pow(volatility, 2)) * dt + volatility * phi * pow(dt, 0.5)));
+		}
+
+		// calculate A
+		double A;
+		double A_sum{ 0 };
+		for (int i{ 1 }; i <= K; i++) A_sum += stock_path[i];
+		A = A_sum / K;
+
+		// add in the payoff
+		sum += std::max(stock_path.back() - A, 0.);
+	}
+
+	// average over all paths
+	return exp(-interest_rate * expiration) * sum / N;
+}
+
+// value Asian call with antithetic variables, the original kernel storing both paths in vectors
+double value_Asian_call_antithetic_vector(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const double& K, std::mt19937& rnd)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// initalise sum to zero
+	double sum{ 0 };
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		// time step
+		double dt{ expiration / K };
+
+		// containers for stock path
+		std::vector<double> stock_path1;
+		std::vector<double> stock_path2;
+
+		// record initial values
+		stock_path1.push_back(initial_share_price);
+		stock_path2.push_back(initial_share_price);
+
+		// generate stock path
+		for (int i{ 1 }; i <= K; i++) {
+
+			// generate random number
+			double phi = ND(rnd);
+
+			// gemerate stock path
+			stock_path1.push_back(stock_path1[i - 1] * exp((interest_rate - dividend_rate -
+				0.5 * pow(volatility, 2)) * dt + volatility * phi * pow(dt, 0.5)));
+			stock_path2.push_back(stock_path2[i - 1] * exp((interest_rate - dividend_rate -
+				0.5 * pow(volatility, 2)) * dt - volatility * phi * pow(dt, 0.5)));
+		}
+
+		// calculate A
+		double A1, A2;
+		double A1_sum{ 0 }, A2_sum{ 0 };
+		for (int i{ 1 }; i <= K; i++) {
+			A1_sum += stock_path1[i];
+			A2_sum += stock_path2[i];
+		}
+		A1 = A1_sum / K;
+		A2 = A2_sum / K;
+
+		// add in the payoff
+		sum += std::max(stock_path1.back() - A1, 0.);
+		sum += std::max(stock_path2.back() - A2, 0.);
+	}
+
+	// average over all paths
+	return exp(-interest_rate * expiration) * sum / (2.*N);
+}
+
+// value Asian call keeping only the running log share price and running sum
+// the path never needs to be stored, the average only needs the running sum and the payoff only the last share price
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, std::mt19937& rnd)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+	double log_initial_share_price = log(initial_share_price);
+	int steps = (int)K;
+
+	// initalise sum to zero
+	double sum{ 0 };
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		// step the path, accumulating the average as we go
+		double log_share_price = log_initial_share_price;
+		double share_price{ initial_share_price };
+		double A_sum{ 0 };
+		for (int j{ 0 }; j < steps; j++) {
+			log_share_price += drift + diffusion * ND(rnd);
+			share_price = exp(log_share_price);
+			A_sum += share_price;
+		}
+
+		// add in the payoff
+		sum += std::max(share_price - A_sum / K, 0.);
+	}
+
+	// average over all paths
+	return exp(-interest_rate * expiration) * sum / N;
+}
+
+// value Asian call with antithetic variables keeping only the running log share prices and running sums
+// the antithetic log share price is the reflection of the first about the drift line, log S2 = 2 (log S0 + j drift) - log S1,
+// so S2 = exp(2 (log S0 + j drift)) / S1 costs a division rather than a second exponential
+double value_Asian_call_antithetic(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const double& K, std::mt19937& rnd)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+	double log_initial_share_price = log(initial_share_price);
+	int steps = (int)K;
+
+	// square of the drift line at every step, the same for every path
+	double reflection[1024];
+	int reflection_steps = std::min(steps, 1024);
+	for (int j{ 0 }; j < reflection_steps; j++) reflection[j] = exp(2 * (log_initial_share_price + (j + 1) * drift));
+
+	// initalise sum to zero
+	double sum{ 0 };
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		// step both paths, accumulating the averages as we go
+		double log_share_price = log_initial_share_price;
+		double share_price1{ initial_share_price }, share_price2{ initial_share_price };
+		double A1_sum{ 0 }, A2_sum{ 0 };
+		for (int j{ 0 }; j < steps; j++) {
+			double phi = ND(rnd);
+			log_share_price += drift + diffusion * phi;
+			share_price1 = exp(log_share_price);
+			share_price2 = (j < reflection_steps) ? reflection[j] / share_price1
+				: exp(2 * (log_initial_share_price + (j + 1) * drift) - log_share_price);
+			A1_sum += share_price1;
+			A2_sum += share_price2;
+		}
+
+		// add in the payoff
+		sum += std::max(share_price1 - A1_sum / K, 0.);
+		sum += std::max(share_price2 - A2_sum / K, 0.);
+	}
+
+	// average over all paths
+	return exp(-interest_rate * expiration) * sum / (2.*N);
+}
+
+
+// time to draw the normals alone, the floor for any kernel using this generator
+double time_normals(const int& count, std::mt19937& rnd, double& sum)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// draw and sum so the draws are not optimised away
+	auto start = std::chrono::steady_clock::now();  // get start time
+	sum = 0;
+	for (int i{ 0 }; i < count; i++) sum += ND(rnd);
+	auto finish = std::chrono::steady_clock::now();  // get finish time
+	auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+	return elapsed.count();
+}
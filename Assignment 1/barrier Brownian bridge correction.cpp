@@ -0,0 +1,245 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <string>
+
+
+// payoff accumulator fed one path at a time: start at the initial share price, step at every monitoring date, then payoff
+class path_payoff
+{
+public:
+	virtual ~path_payoff() {}
+	virtual std::string name() const = 0;
+	virtual void start(const double& share_price) = 0;
+	virtual void step(const double& share_price) = 0;
+	virtual double payoff(const double& share_price) const = 0;
+};
+
+// up and out call max(S_T - X, 0) if S stays below the barrier at every monitoring date, barrier flag
+class up_and_out_call : public path_payoff
+{
+public:
+	up_and_out_call(const double& strike, const double& barrier_level) : strike_price(strike), barrier(barrier_level) {}
+	std::string name() const { return "up and out call"; }
+	void start(const double& share_price) { knocked_out = share_price >= barrier; }
+	void step(const double& share_price) { if (share_price >= barrier) knocked_out = true; }
+	double payoff(const double& share_price) const { return knocked_out ? 0 : std::max(share_price - strike_price, 0.); }
+private:
+	double strike_price, barrier;
+	bool knocked_out{ false };
+};
+
+// continuously monitored up and out call max(S_T - X, 0) with the Brownian bridge crossing correction
+// given log S at the ends of a step both below log H, the log share price crosses the barrier inside the step with probability
+// exp(-2 (log H - log S_j)(log H - log S_(j+1)) / (sigma^2 dt)), so the payoff is weighted by the probability of surviving every step
+class up_and_out_call_bridge : public path_payoff
+{
+public:
+	up_and_out_call_bridge(const double& strike, const double& barrier_level, const double& volatility, const double& dt)
+		: strike_price(strike), log_barrier(log(barrier_level)), variance_step(pow(volatility, 2) * dt) {}
+	std::string name() const { return "up and out call bridge"; }
+	void start(const double& share_price) { log_previous = log(share_price); survival = (log_previous < log_barrier) ? 1 : 0; }
+	void step(const double& share_price)
+	{
+		double log_current = log(share_price);
+		if (log_current >= log_barrier) survival = 0;
+		else survival *= 1 - exp(-2 * (log_barrier - log_previous) * (log_barrier - log_current) / variance_step);
+		log_previous = log_current;
+	}
+	double payoff(const double& share_price) const { return survival * std::max(share_price - strike_price, 0.); }
+private:
+	double strike_price, log_barrier, variance_step;
+	double log_previous{ 0 }, survival{ 1 };
+};
+
+
+// Function declerations
+
+// value every payoff in the list from one set of paths, returning values, standard errors and the correlation of the errors
+void value_path_payoffs(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const std::vector<path_payoff*>& payoffs, std::mt19937& rnd, std::vector<double>& values,
+	std::vector<double>& standard_errors, std::vector<std::vector<double>>& correlations);
+
+// analytic continuously monitored up and out call with strike below the barrier (Reiner and Rubinstein)
+double analytic_up_and_out_call(const double& share_price, const double& strike_price, const double& barrier, const double& interest_rate,
+	const double& dividend_rate, const double& volatility, const double& expiration);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double volatility{ 0.37 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.04 };
+	double initial_share_price{ 900 };
+	double strike_price{ 900 };
+	double barrier{ 1400 };
+	int N{ 100000 };  // number of MC paths
+	double tolerance{ 0.5 };  // accepted bias against continuous monitoring
+
+	double analytic = analytic_up_and_out_call(initial_share_price, strike_price, barrier, interest_rate, dividend_rate, volatility, expiration);
+	std::cout << std::setprecision(6) << "continuous up and out call = " << analytic << std::endl;
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("barrier bridge correction.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+
+	// discrete monitoring and the bridge correction from the same paths
+	int discrete_K{ 0 }, bridge_K{ 0 };
+	double last_discrete_bias{ 0 };
+	std::vector<int> K_store{ 5, 10, 20, 50, 100, 200, 400 };
+	for (int K : K_store) {
+
+		up_and_out_call discrete(strike_price, barrier);
+		up_and_out_call_bridge bridge(strike_price, barrier, volatility, expiration / K);
+		std::mt19937 rnd(K);
+		std::vector<double> values, standard_errors;
+		std::vector<std::vector<double>> correlations;
+		value_path_payoffs(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, { &discrete, &bridge }, rnd, values,
+			standard_errors, correlations);
+
+		std::cout << "K = " << std::setw(4) << K << ": discrete = " << std::setw(9) << values[0] << " +- " << std::setw(8) << standard_errors[0]
+			<< " (bias " << std::setw(9) << values[0] - analytic << "), bridge = " << std::setw(9) << values[1] << " +- " << std::setw(8)
+			<< standard_errors[1] << " (bias " << std::setw(9) << values[1] - analytic << ")" << std::endl;
+		output << K << "," << values[0] << "," << standard_errors[0] << "," << values[1] << "," << standard_errors[1] << std::endl;
+
+		// fewest steps within tolerance of continuous monitoring
+		if (discrete_K == 0 && fabs(values[0] - analytic) < tolerance) discrete_K = K;
+		if (bridge_K == 0 && fabs(values[1] - analytic) < tolerance) bridge_K = K;
+		last_discrete_bias = values[0] - analytic;
+	}
+
+	// the discrete monitoring bias falls as 1 / sqrt(K) (Broadie, Glasserman and Kou), which gives the steps it would need
+	if (discrete_K == 0) discrete_K = (int)ceil(K_store.back() * pow(last_discrete_bias / tolerance, 2));
+	output.close();
+
+	std::cout << "steps for a bias below " << tolerance << ": discrete = " << discrete_K << ", bridge = " << bridge_K << ", cost ratio = "
+		<< double(discrete_K) / bridge_K << std::endl;
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// value every payoff in the list from one set of paths, returning values, standard errors and the correlation of the errors
+// each path is generated once and fed to every accumulator, the sums of products of payoffs give the covariance of the estimates
+void value_path_payoffs(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const std::vector<path_payoff*>& payoffs, std::mt19937& rnd, std::vector<double>& values,
+	std::vector<double>& standard_errors, std::vector<std::vector<double>>& correlations)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+	double log_initial_share_price = log(initial_share_price);
+	int M = payoffs.size();
+
+	// initalise sums to zero
+	std::vector<double> sums(M, 0.), path_payoffs(M, 0.);
+	std::vector<std::vector<double>> sum_products(M, std::vector<double>(M, 0.));
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		// step the path once, feeding every accumulator
+		for (int p{ 0 }; p < M; p++) payoffs[p]->start(initial_share_price);
+		double log_share_price = log_initial_share_price;
+		double share_price{ initial_share_price };
+		for (int j{ 0 }; j < K; j++) {
+			log_share_price += drift + diffusion * ND(rnd);
+			share_price = exp(log_share_price);
+			for (int p{ 0 }; p < M; p++) payoffs[p]->step(share_price);
+		}
+
+		// add in the payoffs
+		for (int p{ 0 }; p < M; p++) {
+			path_payoffs[p] = payoffs[p]->payoff(share_price);
+			sums[p] += path_payoffs[p];
+		}
+		for (int p{ 0 }; p < M; p++) {
+			for (int q{ p }; q < M; q++) sum_products[p][q] += path_payoffs[p] * path_payoffs[q];
+		}
+	}
+
+	// average over all paths
+	double discount = exp(-interest_rate * expiration);
+	values = std::vector<double>(M);
+	standard_errors = std::vector<double>(M);
+	correlations = std::vector<std::vector<double>>(M, std::vector<double>(M, 0.));
+	std::vector<std::vector<double>> covariance(M, std::vector<double>(M, 0.));
+	for (int p{ 0 }; p < M; p++) {
+		for (int q{ p }; q < M; q++) {
+			covariance[p][q] = sum_products[p][q] / N - (sums[p] / N) * (sums[q] / N);
+			covariance[q][p] = covariance[p][q];
+		}
+	}
+	for (int p{ 0 }; p < M; p++) {
+		values[p] = discount * sums[p] / N;
+		standard_errors[p] = discount * pow(covariance[p][p] / (N - 1.), 0.5);
+		for (int q{ 0 }; q < M; q++) {
+			double scale = pow(covariance[p][p] * covariance[q][q], 0.5);
+			correlations[p][q] = (scale > 0) ? covariance[p][q] / scale : 0;
+		}
+	}
+}
+
+// analytic continuously monitored up and out call with strike below the barrier (Reiner and Rubinstein)
+// A - B + C - D in the notation of Haug, no rebate
+double analytic_up_and_out_call(const double& share_price, const double& strike_price, const double& barrier, const double& interest_rate,
+	const double& dividend_rate, const double& volatility, const double& expiration)
+{
+	double root_T = volatility * pow(expiration, 0.5);
+	double mu = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) / pow(volatility, 2);
+	double x1 = log(share_price / strike_price) / root_T + (1 + mu) * root_T;
+	double x2 = log(share_price / barrier) / root_T + (1 + mu) * root_T;
+	double y1 = log(pow(barrier, 2) / (share_price * strike_price)) / root_T + (1 + mu) * root_T;
+	double y2 = log(barrier / share_price) / root_T + (1 + mu) * root_T;
+	double forward = share_price * exp(-dividend_rate * expiration);
+	double discounted_strike = strike_price * exp(-interest_rate * expiration);
+	double ratio = barrier / share_price;
+
+	double A = forward * norm_cumm(x1) - discounted_strike * norm_cumm(x1 - root_T);
+	double B = forward * norm_cumm(x2) - discounted_strike * norm_cumm(x2 - root_T);
+	double C = forward * pow(ratio, 2 * (mu + 1)) * norm_cumm(-y1) - discounted_strike * pow(ratio, 2 * mu) * norm_cumm(-y1 + root_T);
+	double D = forward * pow(ratio, 2 * (mu + 1)) * norm_cumm(-y2) - discounted_strike * pow(ratio, 2 * mu) * norm_cumm(-y2 + root_T);
+
+	return A - B + C - D;
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x)
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
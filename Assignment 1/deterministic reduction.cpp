@@ -0,0 +1,479 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <thread>
+
+
+// number of paths in a reduction block, blocks are the unit of work handed to threads
+const int reduction_block{ 4096 };
+
+
+// Function declerations
+
+// perform monte carlo with a plain running sum
+double MonteCarlo_plain(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const long long& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, const unsigned long long& seed);
+
+// perform monte carlo with Neumaier sums inside fixed blocks and a pairwise sum over the blocks
+double MonteCarlo(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const long long& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, const unsigned long long& seed, const int& threads);
+
+// perform monte carlo with an exact sum of the payoffs, used as the reference
+double MonteCarlo_exact(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const long long& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, const unsigned long long& seed);
+
+// pairwise sum of block totals in a fixed tree order
+double pairwise_sum(const std::vector<double>& values, const int& first, const int& last);
+
+// add a value to a compensated (Neumaier) sum
+void compensated_add(double& sum, double& compensation, const double& value);
+
+// add a value to an exact sum held as a list of non-overlapping partials (Shewchuk)
+void exact_add(std::vector<double>& partials, double value);
+
+// standard normal number for a path index, the same index always gives the same number
+double counter_normal(const unsigned long long& seed, const unsigned long long& counter);
+
+// 64 bit mixing function
+unsigned long long splitmix64(unsigned long long x);
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price);
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price);
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price);
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price);
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price);
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate portfolio payoff
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number, 
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike, 
+	const double& binary_call_strike, const double& share_price);
+
+// calculate analytical portfolio value
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+
+// Begin main program
+int main()
+{
+	// constants
+	double expiration{ 0.5 };
+	double volatility{ 0.25 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.01 };
+	double X1{ 450 };
+	double X2{ 700 };
+
+	// portfolio setup
+	int put_number{ 2 };
+	int call_number{ 1 };
+	int binary_put_number{ -700 };
+	int binary_call_number{ 0 };
+	int zero_strike_call_number{ -1 };
+	double put_strike{ X1 };
+	double call_strike{ X2 };
+	double binary_put_strike{ X2 };
+	double binary_call_strike{ 0 };
+	double initial_share_price{ X2 };
+
+	unsigned long long seed{ 20210318 };
+	int max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("deterministic_reduction.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+	output << std::setprecision(17);
+	std::cout << std::setprecision(17);
+
+	// compare the rounding error of the two reductions against the exact sum
+	for (long long N{ 1000000 }; N <= 16000000; N *= 2) {
+
+		double exact = MonteCarlo_exact(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, put_number, call_number,
+			binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike, seed);
+
+		auto start1 = std::chrono::steady_clock::now();  // get start time
+		double plain = MonteCarlo_plain(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, put_number, call_number,
+			binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike, seed);
+		auto finish1 = std::chrono::steady_clock::now();  // get finish time
+		auto elapsed1 = std::chrono::duration_cast<std::chrono::duration<double>> (finish1 - start1);  // convert into seconds
+
+		auto start2 = std::chrono::steady_clock::now();  // get start time
+		double blocked = MonteCarlo(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, put_number, call_number,
+			binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike, seed, 1);
+		auto finish2 = std::chrono::steady_clock::now();  // get finish time
+		auto elapsed2 = std::chrono::duration_cast<std::chrono::duration<double>> (finish2 - start2);  // convert into seconds
+
+		// the blocked reduction must not depend on the number of threads
+		bool identical{ true };
+		for (int threads{ 2 }; threads <= std::max(4, max_threads); threads *= 2) {
+			double threaded = MonteCarlo(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, put_number, call_number,
+				binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike, seed, threads);
+			if (threaded != blocked) identical = false;
+		}
+
+		std::cout << "N = " << N << ": plain error = " << plain - exact << ", blocked error = " << blocked - exact
+			<< ", overhead = " << 100 * (elapsed2.count() / elapsed1.count() - 1) << "%, identical across threads = " << (identical ? "yes" : "no") << std::endl;
+		output << N << "," << exact << "," << plain << "," << blocked << "," << elapsed1.count() << "," << elapsed2.count() << std::endl;
+	}
+
+	// close the file
+	std::cout << "File write successful" << std::endl;
+	output.close();
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// perform monte carlo with a plain running sum
+double MonteCarlo_plain(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const long long& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, const unsigned long long& seed)
+{
+	// constants used on every path
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration;
+	double diffusion = volatility * pow(expiration, 0.5);
+
+	// initialise sum to 0
+	double sum = 0;
+
+	// run the simulations
+	for (long long i{ 0 }; i < N; i++) {
+
+		// get random value of stock value at maturity
+		double final_share_price = initial_share_price * exp(drift + diffusion * counter_normal(seed, i));
+
+		// increment the sum
+		sum += portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+			call_strike, binary_put_strike, binary_call_strike, final_share_price);
+	}
+
+	// output average over all paths
+	return exp(-interest_rate * expiration) * sum / N;
+}
+
+// perform monte carlo with Neumaier sums inside fixed blocks and a pairwise sum over the blocks
+// block b always holds paths [b * reduction_block, (b + 1) * reduction_block) and the blocks are combined in the
+// same tree whatever thread computed them, so the result is bitwise identical for any number of threads
+double MonteCarlo(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const long long& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, const unsigned long long& seed, const int& threads)
+{
+	// constants used on every path
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration;
+	double diffusion = volatility * pow(expiration, 0.5);
+
+	// one total per block
+	int blocks = (N + reduction_block - 1) / reduction_block;
+	std::vector<double> block_sums(blocks, 0.);
+
+	// each thread takes every threads-th block
+	auto work = [&](const int& thread) {
+		for (int b{ thread }; b < blocks; b += threads) {
+
+			double sum{ 0 }, compensation{ 0 };
+			long long last = std::min(N, (long long)(b + 1) * reduction_block);
+			for (long long i{ (long long)b * reduction_block }; i < last; i++) {
+
+				// get random value of stock value at maturity
+				double final_share_price = initial_share_price * exp(drift + diffusion * counter_normal(seed, i));
+
+				// increment the sum
+				compensated_add(sum, compensation, portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number,
+					zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike, final_share_price));
+			}
+			block_sums[b] = sum + compensation;
+		}
+	};
+
+	// run the blocks
+	std::vector<std::thread> pool;
+	for (int t{ 1 }; t < threads; t++) pool.push_back(std::thread(work, t));
+	work(0);
+	for (int t{ 0 }; t < pool.size(); t++) pool[t].join();
+
+	// output average over all paths
+	return exp(-interest_rate * expiration) * pairwise_sum(block_sums, 0, blocks) / N;
+}
+
+// perform monte carlo with an exact sum of the payoffs, used as the reference
+double MonteCarlo_exact(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const long long& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, const unsigned long long& seed)
+{
+	// constants used on every path
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration;
+	double diffusion = volatility * pow(expiration, 0.5);
+
+	// exact sum as a list of partials
+	std::vector<double> partials;
+
+	// run the simulations
+	for (long long i{ 0 }; i < N; i++) {
+
+		// get random value of stock value at maturity
+		double final_share_price = initial_share_price * exp(drift + diffusion * counter_normal(seed, i));
+
+		// increment the sum
+		exact_add(partials, portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+			call_strike, binary_put_strike, binary_call_strike, final_share_price));
+	}
+
+	// round the partials once
+	double sum{ 0 };
+	for (int i{ 0 }; i < partials.size(); i++) sum += partials[i];
+
+	// output average over all paths
+	return exp(-interest_rate * expiration) * sum / N;
+}
+
+// pairwise sum of block totals in a fixed tree order
+double pairwise_sum(const std::vector<double>& values, const int& first, const int& last)
+{
+	if (last - first <= 0) return 0;
+	if (last - first == 1) return values[first];
+	int middle = first + (last - first) / 2;
+	return pairwise_sum(values, first, middle) + pairwise_sum(values, middle, last);
+}
+
+// add a value to a compensated (Neumaier) sum
+void compensated_add(double& sum, double& compensation, const double& value)
+{
+	double t = sum + value;
+	if (fabs(sum) >= fabs(value)) compensation += (sum - t) + value;
+	else compensation += (value - t) + sum;
+	sum = t;
+}
+
+// add a value to an exact sum held as a list of non-overlapping partials (Shewchuk)
+void exact_add(std::vector<double>& partials, double value)
+{
+	int kept{ 0 };
+	for (int i{ 0 }; i < partials.size(); i++) {
+		double y = partials[i];
+		if (fabs(value) < fabs(y)) std::swap(value, y);
+		double high = value + y;
+		double low = y - (high - value);
+		if (low != 0) partials[kept++] = low;
+		value = high;
+	}
+	partials.resize(kept);
+	partials.push_back(value);
+}
+
+// standard normal number for a path index, the same index always gives the same number
+double counter_normal(const unsigned long long& seed, const unsigned long long& counter)
+{
+	// two independent uniforms in (0, 1) from hashes of the seed and counter
+	unsigned long long key = splitmix64(seed) ^ (2 * counter);
+	double u1 = ((splitmix64(key) >> 11) + 0.5) / 9007199254740992.;
+	double u2 = ((splitmix64(key + 1) >> 11) + 0.5) / 9007199254740992.;
+
+	// Box-Muller
+	return cos(2 * M_PI * u2) * pow(-2 * log(u1), 0.5);
+}
+
+// 64 bit mixing function
+unsigned long long splitmix64(unsigned long long x)
+{
+	x += 0x9e3779b97f4a7c15ULL;
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+	return x ^ (x >> 31);
+}
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return (log(share_price / strike_price) + (interest_rate - divident_rate + pow(volatility, 2) / 2) * (expiration - time)) / (volatility * pow(expiration - time, 0.5));
+}
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time) - volatility * pow(expiration - time, 0.5);
+}
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price) 
+{
+	return std::max(strike_price - share_price, 0.);
+}
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+
+	return strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val) - share_price * exp(-dividend_rate * (expiration - time)) * norm_cumm(-d1_val);
+}
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price) 
+{
+	return std::max(share_price - strike_price, 0.);
+}
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return share_price * exp(-divident_rate * (expiration - time)) * norm_cumm(d1_val) - strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 1;
+	else return 0;
+}
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val);
+}
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 0;
+	else return 1;
+}
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price) 
+{
+	return share_price;
+}
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return share_price * exp(-divident_rate * (expiration - time));
+}
+
+// calculate portfolio value
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price)
+{
+	return put_number * payoff_put(share_price, put_strike) + call_number * payoff_call(share_price, call_strike) +
+		binary_put_number * payoff_binary_put(share_price, binary_put_strike) + binary_call_number * payoff_binary_call(share_price, binary_call_strike) +
+		zero_strike_call_number * payoff_zero_strike_call(share_price);
+}
+
+// calculate analystical portfolio
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return put_number * analytic_put(share_price, put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		call_number * analytic_call(share_price, call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_put_number * analytic_binary_put(share_price, binary_put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_call_number * analytic_binary_call(share_price, binary_call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		zero_strike_call_number * analytic_zero_strike_call(share_price, interest_rate, divident_rate, volatility, expiration, time);
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x) 
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
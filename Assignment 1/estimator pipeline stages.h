@@ -0,0 +1,130 @@
+#pragma once
+// Header file for the estimator pipeline stages shared by estimator pipeline.cpp and method selector.cpp
+// an estimator is MC_pipeline<sampler, path transform, payoff, reducer>, every stage is a small class whose
+// member functions are visible at compile time, so each combination is generated and inlined like hand written code;
+// samplers are defined by each program and are constructed as sampler(N, seed) and provide next()
+
+#include <cmath>
+
+
+// path transform: one terminal value per normal
+class standard_transform
+{
+public:
+	static const int samples_per_path{ 1 };
+	template <typename sampler, typename payoff>
+	static void path(sampler& draw, const payoff& pay, const double& S0, const double& drift, const double& volatility, const double& root_T,
+		double& value, double& control)
+	{
+		double final_share_price = S0 * exp(drift + volatility * draw.next() * root_T);
+		value = pay(final_share_price);
+		control = final_share_price;
+	}
+};
+
+// path transform: terminal values from phi and -phi
+class antithetic_transform
+{
+public:
+	static const int samples_per_path{ 2 };
+	template <typename sampler, typename payoff>
+	static void path(sampler& draw, const payoff& pay, const double& S0, const double& drift, const double& volatility, const double& root_T,
+		double& value, double& control)
+	{
+		double phi = draw.next();
+		double final_share_price_plus = S0 * exp(drift + volatility * phi * root_T);
+		double final_share_price_minus = S0 * exp(drift - volatility * phi * root_T);
+		value = pay(final_share_price_plus) + pay(final_share_price_minus);
+		control = final_share_price_plus + final_share_price_minus;
+	}
+};
+
+// path transform: terminal values from two consecutive normals, as used with the two Halton streams
+class paired_transform
+{
+public:
+	static const int samples_per_path{ 2 };
+	template <typename sampler, typename payoff>
+	static void path(sampler& draw, const payoff& pay, const double& S0, const double& drift, const double& volatility, const double& root_T,
+		double& value, double& control)
+	{
+		double phi_1 = draw.next();
+		double phi_2 = draw.next();
+		double final_share_price_plus = S0 * exp(drift + volatility * phi_1 * root_T);
+		double final_share_price_minus = S0 * exp(drift + volatility * phi_2 * root_T);
+		value = pay(final_share_price_plus) + pay(final_share_price_minus);
+		control = final_share_price_plus + final_share_price_minus;
+	}
+};
+
+// payoff: the assignment portfolio, single options are portfolios with one non zero holding, operator() is defined with portfolio_payoff
+class portfolio
+{
+public:
+	int put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number;
+	double put_strike, call_strike, binary_put_strike, binary_call_strike;
+	double operator()(const double& share_price) const;
+};
+
+// reducer: plain average
+class plain_reducer
+{
+public:
+	void add(const double& value, const double& control) { sum += value; }
+	double total(const int& samples, const double& control_mean) const { return sum; }
+private:
+	double sum{ 0 };
+};
+
+// reducer: control variate on the terminal share price, whose mean is known, with the optimal coefficient
+class control_variate_reducer
+{
+public:
+	void add(const double& value, const double& control)
+	{
+		sum += value;
+		sum_control += control;
+		sum_product += value * control;
+		sum_control_sq += control * control;
+		paths++;
+	}
+	double total(const int& samples, const double& control_mean) const
+	{
+		// optimal coefficient from the per path covariance, the control over all samples has mean samples * control_mean
+		double mean = sum / paths, mean_control = sum_control / paths;
+		double covariance = sum_product / paths - mean * mean_control;
+		double variance = sum_control_sq / paths - mean_control * mean_control;
+		double beta = variance > 0 ? covariance / variance : 0;
+		return sum - beta * (sum_control - samples * control_mean);
+	}
+private:
+	double sum{ 0 }, sum_control{ 0 }, sum_product{ 0 }, sum_control_sq{ 0 };
+	long long paths{ 0 };
+};
+
+
+// perform monte carlo with any combination of sampler, path transform, payoff and reducer
+template <typename sampler, typename transform, typename payoff, typename reducer>
+double MC_pipeline(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const payoff& pay, const unsigned int& seed)
+{
+	// constants used on every path
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration;
+	double root_T = pow(expiration, 0.5);
+
+	// the stages
+	sampler draw(N, seed);
+	reducer reduce;
+
+	// run the simulations
+	for (int i{ 0 }; i < N; i++) {
+		double value, control;
+		transform::path(draw, pay, initial_share_price, drift, volatility, root_T, value, control);
+		reduce.add(value, control);
+	}
+
+	// output average over all samples, the control is the terminal share price with mean S0 exp((r - q) T)
+	double control_mean = initial_share_price * exp((interest_rate - dividend_rate) * expiration);
+	int samples = transform::samples_per_path * N;
+	return exp(-interest_rate * expiration) * reduce.total(samples, control_mean) / samples;
+}
@@ -0,0 +1,647 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include <string>
+#include "estimator pipeline stages.h"  // header file for the path transforms, payoff, reducers and MC_pipeline
+
+
+// Samplers, the other pipeline stages are in estimator pipeline stages.h
+
+// sampler: pseudo random normals from a Mersenne twister, the default seed gives the stream of the hand written estimators
+class pseudo_random_sampler
+{
+public:
+	pseudo_random_sampler(const int& N, const unsigned int& seed) : rng(seed) {}
+	double next() { return ND(rng); }
+private:
+	std::mt19937 rng;
+	std::normal_distribution<double> ND{ 0., 1. };
+};
+
+// sampler: Halton normals from bases 2 and 3 with Box-Muller, alternating between the two streams, the seed is not used
+class Halton_sampler
+{
+public:
+	Halton_sampler(const int& N, const unsigned int& seed);
+	double next() { return (counter++ % 2 == 0) ? normal_1[counter / 2] : normal_2[counter / 2 - 1]; }
+private:
+	std::vector<double> normal_1, normal_2;
+	int counter{ 0 };
+};
+
+
+// Function declerations
+
+// generate Halton sequence
+std::vector<double> Halton_sequence(const int& basis, const int& size);
+
+// perform Halton monte carlo
+double Halton_MC(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike);
+
+// perform antithetic monte carlo
+double antithetic_MC(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike);
+
+// perform monte carlo
+double standard_MC(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike);
+
+// hand written Halton monte carlo with the path constants hoisted out of the loop, as MC_pipeline does
+double Halton_MC_hoisted(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike);
+
+// hand written antithetic monte carlo with the path constants hoisted out of the loop
+double antithetic_MC_hoisted(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike);
+
+// hand written monte carlo with the path constants hoisted out of the loop
+double standard_MC_hoisted(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike);
+
+// time a function over a number of repetitions, returning the fastest time and the value
+template <typename function>
+double best_time(const int& repetitions, function run, double& value);
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price);
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price);
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price);
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price);
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price);
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate portfolio payoff
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number, 
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike, 
+	const double& binary_call_strike, const double& share_price);
+
+// calculate analytical portfolio value
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+
+// Begin main program
+int main()
+{
+	// constants
+	double expiration{ 0.5 };
+	double volatility{ 0.25 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.01 };
+	double X1{ 450 };
+	double X2{ 700 };
+
+	// portfolio setup
+	int put_number{ 2 };
+	int call_number{ 1 };
+	int binary_put_number{ -700 };
+	int binary_call_number{ 0 };
+	int zero_strike_call_number{ -1 };
+	double put_strike{ X1 };
+	double call_strike{ X2 };
+	double binary_put_strike{ X2 };
+	double binary_call_strike{ 0 };
+	double initial_share_price{ X1 };
+
+	int N{ 500000 };  // number of monte carlo simulations to perform
+	int repetitions{ 10 };  // timing repetitions, the fastest is kept
+	unsigned int seed{ std::mt19937::default_seed };  // the seed of the hand written estimators
+
+	portfolio pay{ put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike,
+		binary_put_strike, binary_call_strike };
+
+	// analytic value for reference
+	double current_time{ 0 };
+	double analytic = portfolio_analytic(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number,
+		put_strike, call_strike, binary_put_strike, binary_call_strike, initial_share_price, interest_rate, dividend_rate, volatility,
+		expiration, current_time);
+	std::cout << std::setprecision(10) << "Analytic Pi = " << analytic << ", N = " << N << std::endl << std::endl;
+
+	// hand written estimators against the pipeline equivalents, the fair comparison is with the hand written loops that hoist the same
+	// constants as MC_pipeline, the copies of time comparison.cpp recompute them on every path and are only a secondary reference
+	std::vector<std::string> labels{ "standard", "antithetic", "Halton" };
+	for (int method{ 0 }; method < 3; method++) {
+
+		double hand_value, original_value, pipeline_value, hand_time, original_time, pipeline_time;
+		if (method == 0) {
+			hand_time = best_time(repetitions, [&]() { return standard_MC_hoisted(initial_share_price, interest_rate, dividend_rate, volatility,
+				expiration, N, put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike,
+				binary_put_strike, binary_call_strike); }, hand_value);
+			original_time = best_time(repetitions, [&]() { return standard_MC(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N,
+				put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike,
+				binary_call_strike); }, original_value);
+			pipeline_time = best_time(repetitions, [&]() { return MC_pipeline<pseudo_random_sampler, standard_transform, portfolio, plain_reducer>(
+				initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, pay, seed); }, pipeline_value);
+		}
+		if (method == 1) {
+			hand_time = best_time(repetitions, [&]() { return antithetic_MC_hoisted(initial_share_price, interest_rate, dividend_rate, volatility,
+				expiration, N, put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike,
+				binary_put_strike, binary_call_strike); }, hand_value);
+			original_time = best_time(repetitions, [&]() { return antithetic_MC(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N,
+				put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike,
+				binary_call_strike); }, original_value);
+			pipeline_time = best_time(repetitions, [&]() { return MC_pipeline<pseudo_random_sampler, antithetic_transform, portfolio, plain_reducer>(
+				initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, pay, seed); }, pipeline_value);
+		}
+		if (method == 2) {
+			hand_time = best_time(repetitions, [&]() { return Halton_MC_hoisted(initial_share_price, interest_rate, dividend_rate, volatility,
+				expiration, N, put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike,
+				binary_put_strike, binary_call_strike); }, hand_value);
+			original_time = best_time(repetitions, [&]() { return Halton_MC(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N,
+				put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike,
+				binary_call_strike); }, original_value);
+			pipeline_time = best_time(repetitions, [&]() { return MC_pipeline<Halton_sampler, paired_transform, portfolio, plain_reducer>(
+				initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, pay, seed); }, pipeline_value);
+		}
+
+		std::cout << std::setw(10) << labels[method] << ": hand written = " << hand_value << " (" << hand_time << " s), pipeline = " << pipeline_value
+			<< " (" << pipeline_time << " s), identical = " << (hand_value == pipeline_value ? "yes" : "no")
+			<< ", time ratio = " << pipeline_time / hand_time << std::endl;
+		std::cout << std::setw(10) << "" << "  time comparison.cpp version = " << original_value << " (" << original_time << " s), time ratio = "
+			<< pipeline_time / original_time << std::endl;
+	}
+	std::cout << std::endl;
+
+	// combinations with no hand written version
+	double value;
+	double time = best_time(repetitions, [&]() { return MC_pipeline<pseudo_random_sampler, standard_transform, portfolio, control_variate_reducer>(
+		initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, pay, seed); }, value);
+	std::cout << "standard + control variate            = " << value << " (" << time << " s)" << std::endl;
+	time = best_time(repetitions, [&]() { return MC_pipeline<pseudo_random_sampler, antithetic_transform, portfolio, control_variate_reducer>(
+		initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, pay, seed); }, value);
+	std::cout << "antithetic + control variate          = " << value << " (" << time << " s)" << std::endl;
+	time = best_time(repetitions, [&]() { return MC_pipeline<Halton_sampler, antithetic_transform, portfolio, control_variate_reducer>(
+		initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, pay, seed); }, value);
+	std::cout << "Halton + antithetic + control variate = " << value << " (" << time << " s)" << std::endl;
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// Halton sampler, the two streams as in Halton_MC
+Halton_sampler::Halton_sampler(const int& N, const unsigned int& seed)
+{
+	// generate Halton sequences
+	std::vector<double> random_basis_1 = Halton_sequence(2, N);
+	std::vector<double> random_basis_2 = Halton_sequence(3, N);
+
+	// convert to random normal with Box-Muller
+	for (int i{ 0 }; i < N; i++) {
+		normal_1.push_back(cos(2 * M_PI * random_basis_2[i]) * pow(-2 * log(random_basis_1[i]), 0.5));
+		normal_2.push_back(sin(2 * M_PI * random_basis_1[i]) * pow(-2 * log(random_basis_2[i]), 0.5));
+	}
+}
+
+// portfolio payoff
+double portfolio::operator()(const double& share_price) const
+{
+	return portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+		call_strike, binary_put_strike, binary_call_strike, share_price);
+}
+
+// time a function over a number of repetitions, returning the fastest time and the value
+template <typename function>
+double best_time(const int& repetitions, function run, double& value)
+{
+	double fastest{ 1e300 };
+	for (int i{ 0 }; i < repetitions; i++) {
+		auto start = std::chrono::steady_clock::now();  // get start time
+		value = run();
+		auto finish = std::chrono::steady_clock::now();  // get finish time
+		auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+		fastest = std::min(fastest, elapsed.count());
+	}
+	return fastest;
+}
+
+// generate Halton sequence
+std::vector<double> Halton_sequence(const int& basis, const int& size)
+{
+	// declare vector to return
+	std::vector<double> Halton;
+
+	// generate vector of size N
+	for (int i{ 1 }; i <= size; i++) {
+
+		// initialise variables
+		double temp{ 1 };
+		double Halton_number{ 0 };
+		int index{ i };
+
+		// calculate Halton number at index
+		while (index > 0) {
+
+			temp /= basis;
+			Halton_number += temp * (index % basis);
+			index /= basis;
+		}
+
+		// record the number
+		Halton.push_back(Halton_number);
+	}
+
+	return Halton;
+}
+
+// perform Halton monte carlo
+double Halton_MC(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike)
+{
+	// set the basis
+	int basis_1{ 2 };
+	int basis_2{ 3 };
+
+	// generate Halton sequences
+	std::vector<double> random_basis_1 = Halton_sequence(basis_1, N);
+	std::vector<double> random_basis_2 = Halton_sequence(basis_2, N);
+
+	// initialise new normal distributed vectors
+	std::vector<double> normal_1;
+	std::vector<double> normal_2;
+
+	// calculate new vectors
+	for (int i{ 0 }; i < random_basis_1.size(); i++) {
+		normal_1.push_back(cos(2 * M_PI * random_basis_2[i]) * pow(-2 * log(random_basis_1[i]), 0.5));
+		normal_2.push_back(sin(2 * M_PI * random_basis_1[i]) * pow(-2 * log(random_basis_2[i]), 0.5));
+	}
+
+	// initialise sum to 0
+	double sum = 0;
+
+	// run the simulations
+	for (int i{ 0 }; i < N; i++) {
+
+		// draw a random normally distributed number
+		double phi_1 = normal_1[i];
+		double phi_2 = normal_2[i];
+
+		// get random value of stock value at maturity
+		double final_share_price_plus = initial_share_price * exp((interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration + volatility * phi_1 * pow(expiration, 0.5));
+		double final_share_price_minus = initial_share_price * exp((interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration + volatility * phi_2 * pow(expiration, 0.5));
+
+		// increment the sum
+		sum += portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+			call_strike, binary_put_strike, binary_call_strike, final_share_price_plus) +
+			portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+				call_strike, binary_put_strike, binary_call_strike, final_share_price_minus);
+	}
+
+	// output average over all paths
+	return exp(-interest_rate * expiration) * sum / (2. * N);
+}
+
+// perform antithetic monte carlo
+double antithetic_MC(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike)
+{
+	// declare random number generator, local so every call sees the same stream as the pipeline
+	std::mt19937 rng;
+
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// initialise sum to 0
+	double sum = 0;
+
+	// run the simulations
+	for (int i{ 0 }; i < N; i++) {
+
+		// draw a random normally distributed number
+		double phi = ND(rng);
+
+		// get random value of stock value at maturity vi
+		double final_share_price_plus = initial_share_price * exp((interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration + volatility * phi * pow(expiration, 0.5));
+		double final_share_price_minus = initial_share_price * exp((interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration - volatility * phi * pow(expiration, 0.5));
+
+		// increment the sum
+		sum += portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+			call_strike, binary_put_strike, binary_call_strike, final_share_price_plus) +
+			portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+				call_strike, binary_put_strike, binary_call_strike, final_share_price_minus);
+	}
+
+	// output average over all paths
+	return exp(-interest_rate * expiration) * sum / (2. * N);
+}
+
+// perform standard monte carlo
+double standard_MC(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike)
+{
+	// declare random number generator, local so every call sees the same stream as the pipeline
+	std::mt19937 rng;
+
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// initialise sum to 0
+	double sum = 0;
+
+	// run the simulations
+	for (int i{ 0 }; i < N; i++) {
+
+		// draw a random normally distributed number
+		double phi = ND(rng);
+
+		// get random value of stock value at maturity
+		double final_share_price = initial_share_price * exp((interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration + volatility * phi * pow(expiration, 0.5));
+
+		// increment the sum
+		sum += portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+			call_strike, binary_put_strike, binary_call_strike, final_share_price);
+	}
+
+	// output average over all paths
+	return exp(-interest_rate * expiration) * sum / N;
+}
+
+// hand written Halton monte carlo with the path constants hoisted out of the loop, as MC_pipeline does
+double Halton_MC_hoisted(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike)
+{
+	// generate Halton sequences
+	std::vector<double> random_basis_1 = Halton_sequence(2, N);
+	std::vector<double> random_basis_2 = Halton_sequence(3, N);
+
+	// convert to random normal with Box-Muller
+	std::vector<double> normal_1, normal_2;
+	for (int i{ 0 }; i < N; i++) {
+		normal_1.push_back(cos(2 * M_PI * random_basis_2[i]) * pow(-2 * log(random_basis_1[i]), 0.5));
+		normal_2.push_back(sin(2 * M_PI * random_basis_1[i]) * pow(-2 * log(random_basis_2[i]), 0.5));
+	}
+
+	// constants used on every path
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration;
+	double root_T = pow(expiration, 0.5);
+
+	// run the simulations
+	double sum = 0;
+	for (int i{ 0 }; i < N; i++) {
+		double final_share_price_plus = initial_share_price * exp(drift + volatility * normal_1[i] * root_T);
+		double final_share_price_minus = initial_share_price * exp(drift + volatility * normal_2[i] * root_T);
+		sum += portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+			call_strike, binary_put_strike, binary_call_strike, final_share_price_plus) +
+			portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+				call_strike, binary_put_strike, binary_call_strike, final_share_price_minus);
+	}
+
+	// output average over all paths
+	return exp(-interest_rate * expiration) * sum / (2. * N);
+}
+
+// hand written antithetic monte carlo with the path constants hoisted out of the loop
+double antithetic_MC_hoisted(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike)
+{
+	// declare random number generator and normal distribution, local so every call sees the same stream as the pipeline
+	std::mt19937 rng;
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every path
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration;
+	double root_T = pow(expiration, 0.5);
+
+	// run the simulations
+	double sum = 0;
+	for (int i{ 0 }; i < N; i++) {
+		double phi = ND(rng);
+		double final_share_price_plus = initial_share_price * exp(drift + volatility * phi * root_T);
+		double final_share_price_minus = initial_share_price * exp(drift - volatility * phi * root_T);
+		sum += portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+			call_strike, binary_put_strike, binary_call_strike, final_share_price_plus) +
+			portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+				call_strike, binary_put_strike, binary_call_strike, final_share_price_minus);
+	}
+
+	// output average over all paths
+	return exp(-interest_rate * expiration) * sum / (2. * N);
+}
+
+// hand written monte carlo with the path constants hoisted out of the loop
+double standard_MC_hoisted(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike)
+{
+	// declare random number generator and normal distribution, local so every call sees the same stream as the pipeline
+	std::mt19937 rng;
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every path
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration;
+	double root_T = pow(expiration, 0.5);
+
+	// run the simulations
+	double sum = 0;
+	for (int i{ 0 }; i < N; i++) {
+		double final_share_price = initial_share_price * exp(drift + volatility * ND(rng) * root_T);
+		sum += portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+			call_strike, binary_put_strike, binary_call_strike, final_share_price);
+	}
+
+	// output average over all paths
+	return exp(-interest_rate * expiration) * sum / N;
+}
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return (log(share_price / strike_price) + (interest_rate - divident_rate + pow(volatility, 2) / 2) * (expiration - time)) / (volatility * pow(expiration - time, 0.5));
+}
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time) - volatility * pow(expiration - time, 0.5);
+}
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price) 
+{
+	return std::max(strike_price - share_price, 0.);
+}
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+
+	return strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val) - share_price * exp(-dividend_rate * (expiration - time)) * norm_cumm(-d1_val);
+}
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price) 
+{
+	return std::max(share_price - strike_price, 0.);
+}
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return share_price * exp(-divident_rate * (expiration - time)) * norm_cumm(d1_val) - strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 1;
+	else return 0;
+}
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val);
+}
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 0;
+	else return 1;
+}
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price) 
+{
+	return share_price;
+}
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return share_price * exp(-divident_rate * (expiration - time));
+}
+
+// calculate portfolio value
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price)
+{
+	return put_number * payoff_put(share_price, put_strike) + call_number * payoff_call(share_price, call_strike) +
+		binary_put_number * payoff_binary_put(share_price, binary_put_strike) + binary_call_number * payoff_binary_call(share_price, binary_call_strike) +
+		zero_strike_call_number * payoff_zero_strike_call(share_price);
+}
+
+// calculate analystical portfolio
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return put_number * analytic_put(share_price, put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		call_number * analytic_call(share_price, call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_put_number * analytic_binary_put(share_price, binary_put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_call_number * analytic_binary_call(share_price, binary_call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		zero_strike_call_number * analytic_zero_strike_call(share_price, interest_rate, divident_rate, volatility, expiration, time);
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x) 
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
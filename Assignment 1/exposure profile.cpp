@@ -0,0 +1,590 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <thread>
+
+
+// number of paths in a block, blocks are the unit of work handed to threads and the unit of batched revaluation
+const int exposure_block{ 2048 };
+
+
+// scalar exposure sums of one date, small enough to keep one set per block
+struct exposure_sums
+{
+	long long count{ 0 };  // number of paths
+	double sum_exposure{ 0 };  // sum of max(V, 0)
+	double sum_negative_exposure{ 0 };  // sum of min(V, 0)
+	double sum_discounted{ 0 }, sum_discounted_sq{ 0 };  // sums of exp(-r t) V and its square, a martingale check
+};
+
+// exposure statistics of one date, the sums and a fixed size histogram for the quantiles
+struct exposure_accumulator : exposure_sums
+{
+	double sketch_lower{ -3000 }, sketch_upper{ 1000 };  // range of the value histogram
+	std::vector<long long> sketch = std::vector<long long>(4000, 0);  // value histogram
+};
+
+
+// Function declerations
+
+// simulate spot on the date grid and revalue the portfolio on every path and date with batched analytic formulas
+std::vector<exposure_accumulator> exposure_profile(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const std::vector<double>& dates, const long long& N, const int& put_number,
+	const int& call_number, const int& binary_put_number, const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike,
+	const double& call_strike, const double& binary_put_strike, const double& binary_call_strike, const unsigned long long& seed, const int& threads);
+
+// the same exposures with portfolio_analytic called for every path and date
+std::vector<exposure_accumulator> exposure_profile_naive(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const std::vector<double>& dates, const long long& N, const int& put_number,
+	const int& call_number, const int& binary_put_number, const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike,
+	const double& call_strike, const double& binary_put_strike, const double& binary_call_strike, const unsigned long long& seed);
+
+// revalue the portfolio at one date for a block of log share prices
+void revalue_block(const std::vector<double>& log_share_prices, const int& size, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& time, const int& put_number, const int& call_number,
+	const int& binary_put_number, const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike,
+	const double& call_strike, const double& binary_put_strike, const double& binary_call_strike, std::vector<double>& N_d1,
+	std::vector<double>& N_d2, std::vector<double>& values);
+
+// add a portfolio value to the statistics of a date
+void add_exposure(exposure_accumulator& accumulator, const double& value, const double& discount);
+
+// add a portfolio value to the scalar sums of a date
+void add_sums(exposure_sums& sums, const double& value, const double& discount);
+
+// add a portfolio value to the histogram of a date
+void add_to_sketch(exposure_accumulator& accumulator, const double& value);
+
+// quantile of the portfolio value from the histogram sketch
+double sketch_quantile(const exposure_accumulator& accumulator, const double& probability);
+
+// standard normal number for a path index, the same index always gives the same number
+double counter_normal(const unsigned long long& seed, const unsigned long long& counter);
+
+// 64 bit mixing function
+unsigned long long splitmix64(unsigned long long x);
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price);
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price);
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price);
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price);
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price);
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate portfolio payoff
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number, 
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike, 
+	const double& binary_call_strike, const double& share_price);
+
+// calculate analytical portfolio value
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+
+// Begin main program
+int main()
+{
+	// constants
+	double expiration{ 0.5 };
+	double volatility{ 0.25 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.01 };
+	double X1{ 450 };
+	double X2{ 700 };
+	double initial_share_price{ X1 };
+
+	// portfolio
+	int put_number{ 2 };
+	double put_strike{ X1 };
+	int call_number{ 1 };
+	double call_strike{ X2 };
+	int binary_put_number{ -700 };
+	double binary_put_strike{ X2 };
+	int binary_call_number{ 0 };
+	double binary_call_strike{ 0 };
+	int zero_strike_call_number{ -1 };
+
+	// weekly exposure dates up to and including expiry
+	std::vector<double> dates;
+	for (int j{ 1 }; j <= 26; j++) dates.push_back(expiration * j / 26);
+
+	long long N{ 200000 };
+	unsigned long long seed{ 20210318 };
+	int threads = std::max(1u, std::thread::hardware_concurrency());
+	double value_today = portfolio_analytic(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+		call_strike, binary_put_strike, binary_call_strike, initial_share_price, interest_rate, dividend_rate, volatility, expiration, 0);
+
+	// nested loop with a full portfolio_analytic call per path and date
+	auto start = std::chrono::steady_clock::now();  // get start time
+	std::vector<exposure_accumulator> naive = exposure_profile_naive(initial_share_price, interest_rate, dividend_rate, volatility, expiration,
+		dates, N, put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike,
+		binary_put_strike, binary_call_strike, seed);
+	auto finish = std::chrono::steady_clock::now();  // get finish time
+	auto elapsed1 = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+	// batched revaluation over path blocks
+	start = std::chrono::steady_clock::now();  // get start time
+	std::vector<exposure_accumulator> profile = exposure_profile(initial_share_price, interest_rate, dividend_rate, volatility, expiration,
+		dates, N, put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike,
+		binary_put_strike, binary_call_strike, seed, threads);
+	finish = std::chrono::steady_clock::now();  // get finish time
+	auto elapsed2 = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("exposure_profile.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+
+	// write the profile, PFE is the 97.5% quantile of max(V, 0) and the counterparty PFE is the 2.5% quantile of min(V, 0)
+	std::cout << "V(0) = " << value_today << ", N = " << N << ", threads = " << threads << std::endl;
+	std::cout << std::setw(8) << "t" << std::setw(12) << "EE" << std::setw(12) << "ENE" << std::setw(12) << "PFE" << std::setw(12) << "PFE cpty"
+		<< std::setw(14) << "E[df V] - V0" << std::setw(10) << "SE" << std::setw(14) << "naive diff" << std::endl;
+	double max_difference{ 0 };
+	for (int j{ 0 }; j < dates.size(); j++) {
+
+		const exposure_accumulator& a = profile[j];
+		double EE = a.sum_exposure / a.count;
+		double ENE = a.sum_negative_exposure / a.count;
+		double PFE = std::max(0., sketch_quantile(a, 0.975));
+		double PFE_counterparty = std::min(0., sketch_quantile(a, 0.025));
+		double mean = a.sum_discounted / a.count;
+		double standard_error = sqrt((a.sum_discounted_sq / a.count - mean * mean) / (a.count - 1.));
+		double difference = std::max(fabs(EE - naive[j].sum_exposure / naive[j].count), fabs(ENE - naive[j].sum_negative_exposure / naive[j].count));
+		max_difference = std::max(max_difference, difference);
+
+		std::cout << std::setw(8) << std::setprecision(4) << dates[j] << std::setprecision(6) << std::setw(12) << EE << std::setw(12) << ENE
+			<< std::setw(12) << PFE << std::setw(12) << PFE_counterparty << std::setw(14) << mean - value_today << std::setw(10) << standard_error
+			<< std::setw(14) << difference << std::endl;
+		output << dates[j] << "," << EE << "," << ENE << "," << PFE << "," << PFE_counterparty << "," << mean << "," << standard_error << std::endl;
+	}
+	output.close();
+
+	std::cout << "naive time = " << elapsed1.count() << " s, batched time = " << elapsed2.count() << " s, speed up = "
+		<< elapsed1.count() / elapsed2.count() << ", max difference = " << max_difference << std::endl;
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// simulate spot on the date grid and revalue the portfolio on every path and date with batched analytic formulas
+// paths are simulated a block at a time so each date is revalued for a whole block in one pass, with d1 and d2 worked out
+// once per distinct strike rather than once per leg, the scalar sums are kept per block and added in block order and the
+// histograms hold counts, so the profile is identical for any number of threads, only the histograms of each thread are
+// kept so memory does not grow with N beyond a few scalars per block and date
+std::vector<exposure_accumulator> exposure_profile(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const std::vector<double>& dates, const long long& N, const int& put_number,
+	const int& call_number, const int& binary_put_number, const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike,
+	const double& call_strike, const double& binary_put_strike, const double& binary_call_strike, const unsigned long long& seed, const int& threads)
+{
+	int number_dates = dates.size();
+	int blocks = (N + exposure_block - 1) / exposure_block;
+
+	// per block sums for every date and one histogram set per thread
+	std::vector<std::vector<exposure_sums>> block_sums(blocks);
+	std::vector<std::vector<exposure_accumulator>> thread_sketches(threads, std::vector<exposure_accumulator>(number_dates));
+
+	// each thread takes every threads-th block
+	auto work = [&](const int& thread) {
+
+		// work space reused for every block
+		std::vector<double> log_share_prices(exposure_block), N_d1(exposure_block), N_d2(exposure_block), values(exposure_block);
+
+		for (int b{ thread }; b < blocks; b += threads) {
+
+			long long first = (long long)b * exposure_block;
+			int size = std::min(N - first, (long long)exposure_block);
+			for (int i{ 0 }; i < size; i++) log_share_prices[i] = log(initial_share_price);
+
+			std::vector<exposure_sums> sums(number_dates);
+			double previous_time{ 0 };
+			for (int j{ 0 }; j < number_dates; j++) {
+
+				// step the block to the next date
+				double dt = dates[j] - previous_time;
+				double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+				double diffusion = volatility * pow(dt, 0.5);
+				for (int i{ 0 }; i < size; i++) {
+					log_share_prices[i] += drift + diffusion * counter_normal(seed, (first + i) * number_dates + j);
+				}
+				previous_time = dates[j];
+
+				// revalue and record
+				revalue_block(log_share_prices, size, interest_rate, dividend_rate, volatility, expiration, dates[j], put_number, call_number,
+					binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike,
+					N_d1, N_d2, values);
+				double discount = exp(-interest_rate * dates[j]);
+				for (int i{ 0 }; i < size; i++) {
+					add_sums(sums[j], values[i], discount);
+					add_to_sketch(thread_sketches[thread][j], values[i]);
+				}
+			}
+			block_sums[b] = std::move(sums);
+		}
+	};
+
+	// run the blocks
+	std::vector<std::thread> pool;
+	for (int t{ 1 }; t < threads; t++) pool.push_back(std::thread(work, t));
+	work(0);
+	for (int t{ 0 }; t < pool.size(); t++) pool[t].join();
+
+	// sums in block order, histograms in any order
+	std::vector<exposure_accumulator> profile(number_dates);
+	for (int j{ 0 }; j < number_dates; j++) {
+		for (int b{ 0 }; b < blocks; b++) {
+			profile[j].count += block_sums[b][j].count;
+			profile[j].sum_exposure += block_sums[b][j].sum_exposure;
+			profile[j].sum_negative_exposure += block_sums[b][j].sum_negative_exposure;
+			profile[j].sum_discounted += block_sums[b][j].sum_discounted;
+			profile[j].sum_discounted_sq += block_sums[b][j].sum_discounted_sq;
+		}
+		for (int t{ 0 }; t < threads; t++) {
+			for (int k{ 0 }; k < profile[j].sketch.size(); k++) profile[j].sketch[k] += thread_sketches[t][j].sketch[k];
+		}
+	}
+
+	return profile;
+}
+
+// the same exposures with portfolio_analytic called for every path and date
+std::vector<exposure_accumulator> exposure_profile_naive(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const std::vector<double>& dates, const long long& N, const int& put_number,
+	const int& call_number, const int& binary_put_number, const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike,
+	const double& call_strike, const double& binary_put_strike, const double& binary_call_strike, const unsigned long long& seed)
+{
+	int number_dates = dates.size();
+	std::vector<exposure_accumulator> profile(number_dates);
+
+	for (long long i{ 0 }; i < N; i++) {
+
+		double share_price = initial_share_price;
+		double previous_time{ 0 };
+		for (int j{ 0 }; j < number_dates; j++) {
+
+			// step to the next date
+			double dt = dates[j] - previous_time;
+			share_price *= exp((interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt
+				+ volatility * pow(dt, 0.5) * counter_normal(seed, i * number_dates + j));
+			previous_time = dates[j];
+
+			// revalue, at expiry the portfolio is worth its payoff
+			double value;
+			if (dates[j] < expiration) {
+				value = portfolio_analytic(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+					call_strike, binary_put_strike, binary_call_strike, share_price, interest_rate, dividend_rate, volatility, expiration, dates[j]);
+			}
+			else {
+				value = portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+					call_strike, binary_put_strike, binary_call_strike, share_price);
+			}
+			add_exposure(profile[j], value, exp(-interest_rate * dates[j]));
+		}
+	}
+
+	return profile;
+}
+
+// revalue the portfolio at one date for a block of log share prices
+void revalue_block(const std::vector<double>& log_share_prices, const int& size, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& time, const int& put_number, const int& call_number,
+	const int& binary_put_number, const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike,
+	const double& call_strike, const double& binary_put_strike, const double& binary_call_strike, std::vector<double>& N_d1,
+	std::vector<double>& N_d2, std::vector<double>& values)
+{
+	// at expiry the portfolio is worth its payoff
+	if (time >= expiration) {
+		for (int i{ 0 }; i < size; i++) {
+			values[i] = portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+				call_strike, binary_put_strike, binary_call_strike, exp(log_share_prices[i]));
+		}
+		return;
+	}
+
+	// constants for this date
+	double tau = expiration - time;
+	double root_tau = volatility * pow(tau, 0.5);
+	double carry = (interest_rate - dividend_rate + pow(volatility, 2) / 2) * tau;
+	double interest_discount = exp(-interest_rate * tau);
+	double dividend_discount = exp(-dividend_rate * tau);
+
+	// zero strike calls
+	for (int i{ 0 }; i < size; i++) values[i] = zero_strike_call_number * exp(log_share_prices[i]) * dividend_discount;
+
+	// legs grouped by strike, so a strike shared by several legs has d1 and d2 worked out once
+	std::vector<double> strikes{ put_strike, call_strike, binary_put_strike, binary_call_strike };
+	std::vector<int> numbers{ put_number, call_number, binary_put_number, binary_call_number };
+	std::vector<bool> done(4, false);
+	for (int k{ 0 }; k < 4; k++) {
+		if (done[k] || numbers[k] == 0) continue;
+
+		// normal distribution of d1 and d2 for every path at this strike
+		double log_strike = log(strikes[k]);
+		for (int i{ 0 }; i < size; i++) {
+			double d1_val = (log_share_prices[i] - log_strike + carry) / root_tau;
+			N_d1[i] = norm_cumm(d1_val);
+			N_d2[i] = norm_cumm(d1_val - root_tau);
+		}
+
+		// every leg with this strike
+		for (int l{ k }; l < 4; l++) {
+			if (numbers[l] == 0 || strikes[l] != strikes[k]) continue;
+			done[l] = true;
+
+			double discounted_strike = strikes[l] * interest_discount;
+			for (int i{ 0 }; i < size; i++) {
+				double forward = exp(log_share_prices[i]) * dividend_discount;
+				switch (l) {
+				case 0: values[i] += numbers[l] * (discounted_strike * (1 - N_d2[i]) - forward * (1 - N_d1[i])); break;
+				case 1: values[i] += numbers[l] * (forward * N_d1[i] - discounted_strike * N_d2[i]); break;
+				case 2: values[i] += numbers[l] * interest_discount * (1 - N_d2[i]); break;
+				default: values[i] += numbers[l] * interest_discount * N_d2[i]; break;
+				}
+			}
+		}
+	}
+}
+
+// add a portfolio value to the statistics of a date
+void add_exposure(exposure_accumulator& accumulator, const double& value, const double& discount)
+{
+	add_sums(accumulator, value, discount);
+	add_to_sketch(accumulator, value);
+}
+
+// add a portfolio value to the scalar sums of a date
+void add_sums(exposure_sums& sums, const double& value, const double& discount)
+{
+	sums.count++;
+	sums.sum_exposure += std::max(value, 0.);
+	sums.sum_negative_exposure += std::min(value, 0.);
+	sums.sum_discounted += discount * value;
+	sums.sum_discounted_sq += pow(discount * value, 2);
+}
+
+// add a portfolio value to the histogram of a date, values outside the range go in the end bins
+void add_to_sketch(exposure_accumulator& accumulator, const double& value)
+{
+	double bin_width = (accumulator.sketch_upper - accumulator.sketch_lower) / accumulator.sketch.size();
+	int bin = std::max(0, std::min((int)accumulator.sketch.size() - 1, (int)floor((value - accumulator.sketch_lower) / bin_width)));
+	accumulator.sketch[bin]++;
+}
+
+// quantile of the portfolio value from the histogram sketch
+double sketch_quantile(const exposure_accumulator& accumulator, const double& probability)
+{
+	double bin_width = (accumulator.sketch_upper - accumulator.sketch_lower) / accumulator.sketch.size();
+	long long target = (long long)ceil(probability * accumulator.count);
+	long long cumulative{ 0 };
+	for (int i{ 0 }; i < accumulator.sketch.size(); i++) {
+		cumulative += accumulator.sketch[i];
+		if (cumulative >= target) return accumulator.sketch_lower + (i + 0.5) * bin_width;
+	}
+	return accumulator.sketch_upper;
+}
+
+// standard normal number for a path index, the same index always gives the same number
+double counter_normal(const unsigned long long& seed, const unsigned long long& counter)
+{
+	// two independent uniforms in (0, 1) from hashes of the seed and counter
+	unsigned long long key = splitmix64(seed) ^ (2 * counter);
+	double u1 = ((splitmix64(key) >> 11) + 0.5) / 9007199254740992.;
+	double u2 = ((splitmix64(key + 1) >> 11) + 0.5) / 9007199254740992.;
+
+	// Box-Muller
+	return cos(2 * M_PI * u2) * pow(-2 * log(u1), 0.5);
+}
+
+// 64 bit mixing function
+unsigned long long splitmix64(unsigned long long x)
+{
+	x += 0x9e3779b97f4a7c15ULL;
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+	return x ^ (x >> 31);
+}
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return (log(share_price / strike_price) + (interest_rate - divident_rate + pow(volatility, 2) / 2) * (expiration - time)) / (volatility * pow(expiration - time, 0.5));
+}
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time) - volatility * pow(expiration - time, 0.5);
+}
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price) 
+{
+	return std::max(strike_price - share_price, 0.);
+}
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+
+	return strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val) - share_price * exp(-dividend_rate * (expiration - time)) * norm_cumm(-d1_val);
+}
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price) 
+{
+	return std::max(share_price - strike_price, 0.);
+}
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return share_price * exp(-divident_rate * (expiration - time)) * norm_cumm(d1_val) - strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 1;
+	else return 0;
+}
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val);
+}
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 0;
+	else return 1;
+}
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price) 
+{
+	return share_price;
+}
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return share_price * exp(-divident_rate * (expiration - time));
+}
+
+// calculate portfolio value
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price)
+{
+	return put_number * payoff_put(share_price, put_strike) + call_number * payoff_call(share_price, call_strike) +
+		binary_put_number * payoff_binary_put(share_price, binary_put_strike) + binary_call_number * payoff_binary_call(share_price, binary_call_strike) +
+		zero_strike_call_number * payoff_zero_strike_call(share_price);
+}
+
+// calculate analystical portfolio
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return put_number * analytic_put(share_price, put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		call_number * analytic_call(share_price, call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_put_number * analytic_binary_put(share_price, binary_put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_call_number * analytic_binary_call(share_price, binary_call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		zero_strike_call_number * analytic_zero_strike_call(share_price, interest_rate, divident_rate, volatility, expiration, time);
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x) 
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
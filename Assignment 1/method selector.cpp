@@ -0,0 +1,625 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <chrono>
+#include <vector>
+#include <string>
+#include <map>
+#include <sstream>
+#include "estimator pipeline stages.h"  // header file for the path transforms, payoff, reducers and MC_pipeline
+
+
+// Samplers, seeded so repeated runs are independent, the other pipeline stages are in estimator pipeline stages.h
+
+// sampler: pseudo random normals from a Mersenne twister
+class pseudo_random_sampler
+{
+public:
+	pseudo_random_sampler(const int& N, const unsigned int& seed) : rng(seed) {}
+	double next() { return ND(rng); }
+private:
+	std::mt19937 rng;
+	std::normal_distribution<double> ND{ 0., 1. };
+};
+
+// sampler: Halton normals from bases 2 and 3 with Box-Muller, randomly shifted modulo 1 so repeated runs give an error estimate
+class Halton_sampler
+{
+public:
+	Halton_sampler(const int& N, const unsigned int& seed);
+	double next() { return (counter++ % 2 == 0) ? normal_1[counter / 2] : normal_2[counter / 2 - 1]; }
+private:
+	std::vector<double> normal_1, normal_2;
+	int counter{ 0 };
+};
+
+// measured cost and error of one estimator on one product
+struct method_profile
+{
+	double pilot_N{ 0 };  // paths in the pilot run
+	double pilot_error{ 0 };  // standard deviation of the estimate at pilot_N
+	double pilot_time{ 0 };  // seconds per run at pilot_N
+	double rate{ 0.5 };  // error falls as N^-rate
+};
+
+
+// independent replicates of a production run, whose spread gives the standard error that is checked against the tolerance
+const int production_replicates{ 16 };
+
+// estimator configurations
+const std::vector<std::string> method_names{ "standard", "antithetic", "control variate", "antithetic + control variate",
+	"Halton", "Halton + control variate" };
+
+
+// Function declerations
+
+// run one of the estimator configurations in method_names
+double run_method(const int& method, const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const portfolio& pay, const unsigned int& seed);
+
+// measure the error and time of one estimator at two pilot sizes
+method_profile profile_method(const int& method, const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const portfolio& pay, const int& pilot_N, const int& repetitions);
+
+// paths per replicate and total time an estimator needs to reach a standard error of tolerance over production_replicates replicates
+void predicted_cost(const method_profile& profile, const double& tolerance, double& N, double& time);
+
+// cache key of a product, the profiles depend on the market and the holdings as well as the product type
+std::string cache_key(const std::string& product_type, const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const portfolio& pay);
+
+// cheapest estimator for a product and tolerance, profiling the product and caching the profiles if it has not been seen before
+int select_method(const std::string& product_type, const double& tolerance, const double& initial_share_price, const double& interest_rate,
+	const double& dividend_rate, const double& volatility, const double& expiration, const portfolio& pay, const std::string& cache_file,
+	std::vector<method_profile>& profiles);
+
+// price a product to a tolerance with the cheapest estimator, adding replicates until the measured standard error meets the tolerance,
+// met_tolerance is false if the cap on replicates was reached first
+double price_auto(const std::string& product_type, const double& tolerance, const double& initial_share_price, const double& interest_rate,
+	const double& dividend_rate, const double& volatility, const double& expiration, const portfolio& pay, const std::string& cache_file,
+	double& standard_error, int& replicates, bool& met_tolerance);
+
+// read the cached profiles
+std::map<std::string, std::vector<method_profile>> read_cache(const std::string& cache_file);
+
+// write the cached profiles
+void write_cache(const std::string& cache_file, const std::map<std::string, std::vector<method_profile>>& cache);
+
+// generate Halton sequence
+std::vector<double> Halton_sequence(const int& basis, const int& size);
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price);
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price);
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price);
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price);
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price);
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate portfolio payoff
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number, 
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike, 
+	const double& binary_call_strike, const double& share_price);
+
+// calculate analytical portfolio value
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+
+// Begin main program
+int main()
+{
+	// constants
+	double expiration{ 0.5 };
+	double volatility{ 0.25 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.01 };
+	double X1{ 450 };
+	double X2{ 700 };
+	double initial_share_price{ X1 };
+	double current_time{ 0 };
+
+	// products, each a portfolio of put, call, binary put, binary call and zero strike call holdings
+	std::vector<std::string> product_types{ "portfolio", "call", "binary put" };
+	std::vector<portfolio> products{
+		portfolio{ 2, 1, -700, 0, -1, X1, X2, X2, 0 },
+		portfolio{ 0, 1, 0, 0, 0, X1, X1, X2, 0 },
+		portfolio{ 0, 0, 1, 0, 0, X1, X2, X1, 0 } };
+
+	std::string cache_file{ "method_cache.csv" };
+	double tolerance{ 0.001 };  // requested standard error as a fraction of the value
+
+	for (int p{ 0 }; p < products.size(); p++) {
+
+		const portfolio& pay = products[p];
+		double analytic = portfolio_analytic(pay.put_number, pay.call_number, pay.binary_put_number, pay.binary_call_number, pay.zero_strike_call_number,
+			pay.put_strike, pay.call_strike, pay.binary_put_strike, pay.binary_call_strike, initial_share_price, interest_rate, dividend_rate, volatility,
+			expiration, current_time);
+		double absolute_tolerance = tolerance * fabs(analytic);
+
+		// select (profiling on the first call) and report the work normalised efficiency of every estimator
+		std::vector<method_profile> profiles;
+		int method = select_method(product_types[p], absolute_tolerance, initial_share_price, interest_rate, dividend_rate, volatility, expiration,
+			pay, cache_file, profiles);
+
+		std::cout << product_types[p] << " (analytic = " << analytic << ", tolerance = " << absolute_tolerance << ")" << std::endl;
+		for (int m{ 0 }; m < profiles.size(); m++) {
+			double N, time;
+			predicted_cost(profiles[m], absolute_tolerance, N, time);
+			std::cout << "  " << std::setw(30) << std::left << method_names[m] << std::right << " variance x time = " << std::setw(12)
+				<< pow(profiles[m].pilot_error, 2) * profiles[m].pilot_time << "  rate = " << std::setw(5) << std::setprecision(3) << profiles[m].rate
+				<< "  N = " << production_replicates << " x " << std::setw(10) << std::setprecision(6) << N << "  time = " << time << " s" << std::endl;
+		}
+
+		// production call, served from the cache
+		double standard_error;
+		int replicates;
+		bool met_tolerance;
+		auto start = std::chrono::steady_clock::now();  // get start time
+		double value = price_auto(product_types[p], absolute_tolerance, initial_share_price, interest_rate, dividend_rate, volatility, expiration,
+			pay, cache_file, standard_error, replicates, met_tolerance);
+		auto finish = std::chrono::steady_clock::now();  // get finish time
+		auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+		std::cout << "  selected " << method_names[method] << ": value = " << value << " +- " << standard_error << " (" << replicates
+			<< " replicates), error = " << value - analytic << ", time = " << elapsed.count() << " s" << std::endl;
+		if (!met_tolerance) std::cout << "  Warning: replicate limit reached, the standard error is above the tolerance" << std::endl;
+		std::cout << std::endl;
+	}
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// run one of the estimator configurations in method_names
+double run_method(const int& method, const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const portfolio& pay, const unsigned int& seed)
+{
+	switch (method) {
+	case 0: return MC_pipeline<pseudo_random_sampler, standard_transform, portfolio, plain_reducer>(initial_share_price, interest_rate,
+		dividend_rate, volatility, expiration, N, pay, seed);
+	case 1: return MC_pipeline<pseudo_random_sampler, antithetic_transform, portfolio, plain_reducer>(initial_share_price, interest_rate,
+		dividend_rate, volatility, expiration, N, pay, seed);
+	case 2: return MC_pipeline<pseudo_random_sampler, standard_transform, portfolio, control_variate_reducer>(initial_share_price, interest_rate,
+		dividend_rate, volatility, expiration, N, pay, seed);
+	case 3: return MC_pipeline<pseudo_random_sampler, antithetic_transform, portfolio, control_variate_reducer>(initial_share_price, interest_rate,
+		dividend_rate, volatility, expiration, N, pay, seed);
+	case 4: return MC_pipeline<Halton_sampler, standard_transform, portfolio, plain_reducer>(initial_share_price, interest_rate,
+		dividend_rate, volatility, expiration, N, pay, seed);
+	default: return MC_pipeline<Halton_sampler, standard_transform, portfolio, control_variate_reducer>(initial_share_price, interest_rate,
+		dividend_rate, volatility, expiration, N, pay, seed);
+	}
+}
+
+// measure the error and time of one estimator at two pilot sizes
+// the error is the standard deviation over independent repetitions, which also works for the shifted Halton estimators,
+// and the convergence rate comes from comparing the errors at pilot_N and 4 * pilot_N
+method_profile profile_method(const int& method, const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const portfolio& pay, const int& pilot_N, const int& repetitions)
+{
+	std::vector<double> errors, times;
+	for (int size{ 0 }; size < 2; size++) {
+
+		int N = pilot_N * (size == 0 ? 1 : 4);
+		std::vector<double> samples;
+		auto start = std::chrono::steady_clock::now();  // get start time
+		for (int i{ 0 }; i < repetitions; i++) {
+			samples.push_back(run_method(method, initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, pay, 1000 * size + i + 1));
+		}
+		auto finish = std::chrono::steady_clock::now();  // get finish time
+		auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+		// calculate the mean
+		double sum_mean{ 0 };
+		for (int i{ 0 }; i < samples.size(); i++) sum_mean += samples[i];
+		double sample_mean = sum_mean / repetitions;
+
+		// calculate the variance
+		double sum_var{ 0 };
+		for (int i{ 0 }; i < samples.size(); i++) sum_var += pow(samples[i] - sample_mean, 2);
+
+		errors.push_back(sqrt(sum_var / (repetitions - 1.)));
+		times.push_back(elapsed.count() / repetitions);
+	}
+
+	// profile at the larger size, pseudo random estimators converge at exactly N^-0.5 and the quasi monte carlo rate
+	// is kept between that and the best quasi monte carlo can do
+	method_profile profile;
+	profile.pilot_N = 4. * pilot_N;
+	profile.pilot_error = errors[1];
+	profile.pilot_time = times[1];
+	if (method_names[method].find("Halton") != std::string::npos && errors[0] > 0 && errors[1] > 0) profile.rate = std::max(0.5, std::min(1., log(errors[0] / errors[1]) / log(4.)));
+
+	return profile;
+}
+
+// paths per replicate and total time an estimator needs to reach a standard error of tolerance over production_replicates replicates
+// the mean of the replicates has error e(N) / sqrt(replicates), so each replicate needs the error tolerance * sqrt(replicates)
+void predicted_cost(const method_profile& profile, const double& tolerance, double& N, double& time)
+{
+	N = profile.pilot_N * pow(profile.pilot_error / (tolerance * sqrt(production_replicates)), 1. / profile.rate);
+	time = production_replicates * profile.pilot_time * N / profile.pilot_N;
+}
+
+// cache key of a product, the profiles depend on the market and the holdings as well as the product type
+std::string cache_key(const std::string& product_type, const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const portfolio& pay)
+{
+	// full precision and no commas, so the key is a single field of the cache file
+	std::ostringstream key;
+	key << std::setprecision(17) << product_type << " S0=" << initial_share_price << " r=" << interest_rate << " q=" << dividend_rate << " sigma="
+		<< volatility << " T=" << expiration << " holdings=" << pay.put_number << " " << pay.call_number << " " << pay.binary_put_number << " "
+		<< pay.binary_call_number << " " << pay.zero_strike_call_number << " strikes=" << pay.put_strike << " " << pay.call_strike << " "
+		<< pay.binary_put_strike << " " << pay.binary_call_strike;
+	return key.str();
+}
+
+// cheapest estimator for a product and tolerance, profiling the product and caching the profiles if it has not been seen before
+int select_method(const std::string& product_type, const double& tolerance, const double& initial_share_price, const double& interest_rate,
+	const double& dividend_rate, const double& volatility, const double& expiration, const portfolio& pay, const std::string& cache_file,
+	std::vector<method_profile>& profiles)
+{
+	// profile a product whose type, market or holdings have not been seen before
+	std::string key = cache_key(product_type, initial_share_price, interest_rate, dividend_rate, volatility, expiration, pay);
+	std::map<std::string, std::vector<method_profile>> cache = read_cache(cache_file);
+	if (cache.count(key) == 0 || cache[key].size() != method_names.size()) {
+		std::vector<method_profile> new_profiles;
+		for (int m{ 0 }; m < method_names.size(); m++) {
+			new_profiles.push_back(profile_method(m, initial_share_price, interest_rate, dividend_rate, volatility, expiration, pay, 5000, 20));
+		}
+		cache[key] = new_profiles;
+		write_cache(cache_file, cache);
+	}
+	profiles = cache[key];
+
+	// least predicted time for the tolerance
+	int best{ 0 };
+	double best_time{ 1e300 };
+	for (int m{ 0 }; m < method_names.size(); m++) {
+		double N, time;
+		predicted_cost(profiles[m], tolerance, N, time);
+		if (time < best_time) {
+			best = m;
+			best_time = time;
+		}
+	}
+
+	return best;
+}
+
+// price a product to a tolerance with the cheapest estimator, adding replicates until the measured standard error meets the tolerance
+// the predicted size of a replicate is only an extrapolation from the pilot, so the standard error of the mean of independent
+// replicates is measured and more replicates of the same size are run while it is above the tolerance, up to 100 times the
+// starting count, after which met_tolerance is false rather than the value being passed off as meeting the tolerance
+double price_auto(const std::string& product_type, const double& tolerance, const double& initial_share_price, const double& interest_rate,
+	const double& dividend_rate, const double& volatility, const double& expiration, const portfolio& pay, const std::string& cache_file,
+	double& standard_error, int& replicates, bool& met_tolerance)
+{
+	// declare random number generator for the seeds of production runs
+	static std::mt19937 rng(12345);
+
+	std::vector<method_profile> profiles;
+	int method = select_method(product_type, tolerance, initial_share_price, interest_rate, dividend_rate, volatility, expiration, pay, cache_file,
+		profiles);
+	double N, time;
+	predicted_cost(profiles[method], tolerance, N, time);
+	int replicate_N = std::max(100, int(ceil(N)));
+
+	std::vector<double> samples;
+	int target = production_replicates;
+	double sample_mean{ 0 };
+	while (samples.size() < target) {
+
+		// run the missing replicates
+		while (samples.size() < target) {
+			samples.push_back(run_method(method, initial_share_price, interest_rate, dividend_rate, volatility, expiration, replicate_N, pay, rng()));
+		}
+
+		// calculate the mean
+		double sum_mean{ 0 };
+		for (int i{ 0 }; i < samples.size(); i++) sum_mean += samples[i];
+		sample_mean = sum_mean / samples.size();
+
+		// calculate the variance
+		double sum_var{ 0 };
+		for (int i{ 0 }; i < samples.size(); i++) sum_var += pow(samples[i] - sample_mean, 2);
+		standard_error = sqrt(sum_var / (samples.size() - 1.) / samples.size());
+
+		// the error falls as replicates^-0.5, so top up to the count the measured error asks for
+		if (standard_error > tolerance) target = std::min(100 * production_replicates, int(ceil(samples.size() * pow(standard_error / tolerance, 2))));
+	}
+	replicates = samples.size();
+	met_tolerance = standard_error <= tolerance;
+
+	return sample_mean;
+}
+
+// read the cached profiles
+std::map<std::string, std::vector<method_profile>> read_cache(const std::string& cache_file)
+{
+	std::map<std::string, std::vector<method_profile>> cache;
+
+	// open a file stream for reading, a missing cache is empty
+	std::ifstream input(cache_file);
+	if (!input.is_open()) return cache;
+
+	// each line is product,method,pilot_N,pilot_error,pilot_time,rate
+	std::string line;
+	while (std::getline(input, line)) {
+		std::vector<std::string> fields;
+		size_t start{ 0 }, comma;
+		while ((comma = line.find(',', start)) != std::string::npos) {
+			fields.push_back(line.substr(start, comma - start));
+			start = comma + 1;
+		}
+		fields.push_back(line.substr(start));
+		if (fields.size() != 6) continue;
+
+		method_profile profile;
+		profile.pilot_N = std::stod(fields[2]);
+		profile.pilot_error = std::stod(fields[3]);
+		profile.pilot_time = std::stod(fields[4]);
+		profile.rate = std::stod(fields[5]);
+		cache[fields[0]].push_back(profile);
+	}
+
+	return cache;
+}
+
+// write the cached profiles
+void write_cache(const std::string& cache_file, const std::map<std::string, std::vector<method_profile>>& cache)
+{
+	// open a file stream for writing
+	std::ofstream output(cache_file);
+
+	// if file could not be opened carry on without a cache
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return;
+	}
+
+	// write one line per product and method
+	output << std::setprecision(17);
+	for (auto& entry : cache) {
+		for (int m{ 0 }; m < entry.second.size(); m++) {
+			output << entry.first << "," << m << "," << entry.second[m].pilot_N << "," << entry.second[m].pilot_error << ","
+				<< entry.second[m].pilot_time << "," << entry.second[m].rate << std::endl;
+		}
+	}
+	output.close();
+}
+
+// Halton sampler, the two streams as in Halton_MC with a random shift modulo 1
+Halton_sampler::Halton_sampler(const int& N, const unsigned int& seed)
+{
+	// random shift of each basis
+	std::mt19937 rng(seed);
+	std::uniform_real_distribution<double> U(0., 1.);
+	double shift_1 = U(rng), shift_2 = U(rng);
+
+	// generate Halton sequences
+	std::vector<double> random_basis_1 = Halton_sequence(2, N);
+	std::vector<double> random_basis_2 = Halton_sequence(3, N);
+
+	// shift and convert to random normal with Box-Muller
+	for (int i{ 0 }; i < N; i++) {
+		double u1 = fmod(random_basis_1[i] + shift_1, 1.), u2 = fmod(random_basis_2[i] + shift_2, 1.);
+		if (u1 == 0) u1 = 0.5 / N;
+		if (u2 == 0) u2 = 0.5 / N;
+		normal_1.push_back(cos(2 * M_PI * u2) * pow(-2 * log(u1), 0.5));
+		normal_2.push_back(sin(2 * M_PI * u1) * pow(-2 * log(u2), 0.5));
+	}
+}
+
+// portfolio payoff
+double portfolio::operator()(const double& share_price) const
+{
+	return portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+		call_strike, binary_put_strike, binary_call_strike, share_price);
+}
+
+// generate Halton sequence
+std::vector<double> Halton_sequence(const int& basis, const int& size)
+{
+	// declare vector to return
+	std::vector<double> Halton;
+
+	// generate vector of size N
+	for (int i{ 1 }; i <= size; i++) {
+
+		// initialise variables
+		double temp{ 1 };
+		double Halton_number{ 0 };
+		int index{ i };
+
+		// calculate Halton number at index
+		while (index > 0) {
+
+			temp /= basis;
+			Halton_number += temp * (index % basis);
+			index /= basis;
+		}
+
+		// record the number
+		Halton.push_back(Halton_number);
+	}
+
+	return Halton;
+}
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return (log(share_price / strike_price) + (interest_rate - divident_rate + pow(volatility, 2) / 2) * (expiration - time)) / (volatility * pow(expiration - time, 0.5));
+}
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time) - volatility * pow(expiration - time, 0.5);
+}
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price) 
+{
+	return std::max(strike_price - share_price, 0.);
+}
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+
+	return strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val) - share_price * exp(-dividend_rate * (expiration - time)) * norm_cumm(-d1_val);
+}
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price) 
+{
+	return std::max(share_price - strike_price, 0.);
+}
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return share_price * exp(-divident_rate * (expiration - time)) * norm_cumm(d1_val) - strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 1;
+	else return 0;
+}
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val);
+}
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 0;
+	else return 1;
+}
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price) 
+{
+	return share_price;
+}
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return share_price * exp(-divident_rate * (expiration - time));
+}
+
+// calculate portfolio value
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price)
+{
+	return put_number * payoff_put(share_price, put_strike) + call_number * payoff_call(share_price, call_strike) +
+		binary_put_number * payoff_binary_put(share_price, binary_put_strike) + binary_call_number * payoff_binary_call(share_price, binary_call_strike) +
+		zero_strike_call_number * payoff_zero_strike_call(share_price);
+}
+
+// calculate analystical portfolio
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return put_number * analytic_put(share_price, put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		call_number * analytic_call(share_price, call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_put_number * analytic_binary_put(share_price, binary_put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_call_number * analytic_binary_call(share_price, binary_call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		zero_strike_call_number * analytic_zero_strike_call(share_price, interest_rate, divident_rate, volatility, expiration, time);
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x) 
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
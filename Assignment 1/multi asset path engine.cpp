@@ -0,0 +1,362 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <atomic>
+
+
+// number of paths in a block, each block has its own generator stream and is the unit of work handed to threads
+const int basket_block{ 4096 };
+
+// number of paths stepped together inside a block
+const int default_path_tile{ 64 };
+
+// products priced from each path
+const std::vector<std::string> basket_product_names{ "basket Asian call", "best of call" };
+
+
+// d correlated GBM assets stepped at K equally spaced dates, the Cholesky factor of the correlation is computed once and
+// stored scaled by sigma_i sqrt(dt), so a step is log S_i += drift_i + sum_(k <= i) factor[i][k] z_k
+class correlated_GBM
+{
+public:
+	correlated_GBM(const std::vector<double>& initial_share_prices, const double& interest_rate, const std::vector<double>& dividend_rates,
+		const std::vector<double>& volatilities, const std::vector<std::vector<double>>& correlation, const double& expiration, const int& K);
+	bool positive_definite() const { return valid; }
+	int assets() const { return d; }
+	int steps() const { return K; }
+	double log_initial_share_price(const int& i) const { return log_initial[i]; }
+	double drift(const int& i) const { return drifts[i]; }
+	double factor(const int& i, const int& k) const { return scaled_factor[i * d + k]; }
+private:
+	int d, K;
+	bool valid;
+	std::vector<double> log_initial, drifts, scaled_factor;
+};
+
+
+// Function declerations
+
+// value the basket Asian call and best of call over path blocks on several threads, each block with its own random number stream
+void value_basket(const correlated_GBM& model, const double& interest_rate, const double& expiration, const std::vector<double>& weights,
+	const double& strike_price, const int& N, const unsigned int& seed, const int& threads, const int& path_tile, std::vector<double>& values,
+	std::vector<double>& standard_errors, double& asset_step_throughput);
+
+// Neumaier sums of the payoffs and squared payoffs over one block of paths, stepped a tile of paths at a time
+void basket_block_sums(const correlated_GBM& model, const std::vector<double>& weights, const double& strike_price, const int& paths,
+	const int& path_tile, std::mt19937& rnd, std::vector<double>& sums, std::vector<double>& sums_sq);
+
+// lower triangular L with L L^T = matrix, false if the matrix is not positive definite
+bool Cholesky(const std::vector<std::vector<double>>& matrix, std::vector<std::vector<double>>& lower);
+
+// exchange option max(S_1 - S_2, 0) (Margrabe), to check the correlation of the paths through max(S_1, S_2) = S_2 + max(S_1 - S_2, 0)
+double analytic_exchange_option(const double& S1, const double& S2, const double& q1, const double& q2, const double& sigma1,
+	const double& sigma2, const double& rho, const double& expiration);
+
+// pairwise sum of block totals in a fixed tree order
+double pairwise_sum(const std::vector<double>& values, const int& first, const int& last);
+
+// add a value to a compensated (Neumaier) sum
+void compensated_add(double& sum, double& compensation, const double& value);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double interest_rate{ 0.03 };
+	double strike_price{ 900 };
+	int K{ 35 };  // points in the sample path
+	int N{ 100000 };  // number of MC paths
+	unsigned int seed{ 20210318 };
+	int max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+	std::cout << std::setprecision(6);
+
+	// two assets with strike zero, the best of call is S_2 e^(-q_2 T) plus an exchange option
+	{
+		std::vector<double> S0{ 900, 850 }, q{ 0.04, 0.02 }, sigma{ 0.37, 0.25 };
+		double rho{ 0.6 };
+		correlated_GBM model(S0, interest_rate, q, sigma, { { 1, rho }, { rho, 1 } }, expiration, 1);
+		std::vector<double> values, standard_errors;
+		double throughput;
+		value_basket(model, interest_rate, expiration, { 0.5, 0.5 }, 0, 1000000, seed, max_threads, default_path_tile, values, standard_errors,
+			throughput);
+		double analytic = S0[1] * exp(-q[1] * expiration) + analytic_exchange_option(S0[0], S0[1], q[0], q[1], sigma[0], sigma[1], rho, expiration);
+		std::cout << "best of two, strike 0: MC = " << values[1] << " +- " << standard_errors[1] << ", analytic = " << analytic
+			<< ", standard errors = " << (values[1] - analytic) / standard_errors[1] << std::endl;
+	}
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("multi asset basket.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+	output << "assets,path tile,threads,basket Asian call,standard error,best of call,standard error,time,asset steps per second" << std::endl;
+
+	// equal weights, volatilities from 0.25 to 0.45 and correlation 0.5^|i - j| between assets
+	for (int d{ 1 }; d <= 16; d *= 2) {
+
+		std::vector<double> S0(d, 900.), q(d, 0.04), sigma(d), weights(d, 1. / d);
+		std::vector<std::vector<double>> correlation(d, std::vector<double>(d));
+		for (int i{ 0 }; i < d; i++) {
+			sigma[i] = (d == 1) ? 0.37 : 0.25 + 0.2 * i / (d - 1.);
+			for (int k{ 0 }; k < d; k++) correlation[i][k] = pow(0.5, abs(i - k));
+		}
+		correlated_GBM model(S0, interest_rate, q, sigma, correlation, expiration, K);
+		if (!model.positive_definite()) {
+			std::cout << "Error: correlation matrix is not positive definite" << std::endl;
+			return 1;
+		}
+
+		// one path at a time against a tile of paths
+		for (int path_tile : { 1, default_path_tile }) {
+
+			std::vector<double> values, standard_errors;
+			double throughput;
+			auto start = std::chrono::steady_clock::now();  // get start time
+			value_basket(model, interest_rate, expiration, weights, strike_price, N, seed, max_threads, path_tile, values, standard_errors, throughput);
+			auto finish = std::chrono::steady_clock::now();  // get finish time
+			auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+			std::cout << "d = " << std::setw(2) << d << ", tile = " << std::setw(2) << path_tile << ": " << basket_product_names[0] << " = "
+				<< std::setw(9) << values[0] << " +- " << std::setw(8) << standard_errors[0] << ", " << basket_product_names[1] << " = " << std::setw(9)
+				<< values[1] << " +- " << std::setw(8) << standard_errors[1] << ", time = " << std::setw(8) << elapsed.count()
+				<< " s, asset steps per second per thread = " << throughput << std::endl;
+			output << d << "," << path_tile << "," << max_threads << "," << values[0] << "," << standard_errors[0] << "," << values[1] << ","
+				<< standard_errors[1] << "," << elapsed.count() << "," << throughput << std::endl;
+		}
+	}
+	output.close();
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// d correlated GBM assets stepped at K equally spaced dates
+// the factor is kept as a dense d x d row major array with zeros above the diagonal
+correlated_GBM::correlated_GBM(const std::vector<double>& initial_share_prices, const double& interest_rate,
+	const std::vector<double>& dividend_rates, const std::vector<double>& volatilities, const std::vector<std::vector<double>>& correlation,
+	const double& expiration, const int& K) : d(initial_share_prices.size()), K(K)
+{
+	double dt{ expiration / K };
+	std::vector<std::vector<double>> lower;
+	valid = Cholesky(correlation, lower);
+
+	log_initial = std::vector<double>(d);
+	drifts = std::vector<double>(d);
+	scaled_factor = std::vector<double>(d * d, 0.);
+	for (int i{ 0 }; i < d; i++) {
+		log_initial[i] = log(initial_share_prices[i]);
+		drifts[i] = (interest_rate - dividend_rates[i] - 0.5 * pow(volatilities[i], 2)) * dt;
+		if (!valid) continue;
+		for (int k{ 0 }; k <= i; k++) scaled_factor[i * d + k] = volatilities[i] * pow(dt, 0.5) * lower[i][k];
+	}
+}
+
+// value the basket Asian call and best of call over path blocks on several threads, each block with its own random number stream
+// block b draws from a generator seeded by (seed, b) and the block totals are combined in a fixed tree, as in the single asset engine,
+// so the values do not depend on the number of threads; asset_step_throughput is N K d over the summed working time of the threads
+void value_basket(const correlated_GBM& model, const double& interest_rate, const double& expiration, const std::vector<double>& weights,
+	const double& strike_price, const int& N, const unsigned int& seed, const int& threads, const int& path_tile, std::vector<double>& values,
+	std::vector<double>& standard_errors, double& asset_step_throughput)
+{
+	int M = basket_product_names.size();
+
+	// one total per block and product
+	int blocks = (N + basket_block - 1) / basket_block;
+	std::vector<std::vector<double>> block_sums(M, std::vector<double>(blocks, 0.)), block_sums_sq = block_sums;
+	std::vector<double> thread_times(threads, 0.);
+	std::atomic<int> next_block{ 0 };
+
+	// each thread takes the next free block until none are left
+	auto work = [&](const int& thread) {
+		auto start = std::chrono::steady_clock::now();  // get start time
+		std::vector<double> sums, sums_sq;
+		for (int b = next_block++; b < blocks; b = next_block++) {
+
+			// the generator of this block
+			std::seed_seq block_seed{ seed, (unsigned int)b };
+			std::mt19937 rnd(block_seed);
+
+			int paths = std::min(basket_block, N - b * basket_block);
+			basket_block_sums(model, weights, strike_price, paths, path_tile, rnd, sums, sums_sq);
+			for (int m{ 0 }; m < M; m++) {
+				block_sums[m][b] = sums[m];
+				block_sums_sq[m][b] = sums_sq[m];
+			}
+		}
+		auto finish = std::chrono::steady_clock::now();  // get finish time
+		thread_times[thread] = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start).count();
+	};
+
+	// run the blocks
+	std::vector<std::thread> pool;
+	for (int t{ 1 }; t < threads; t++) pool.push_back(std::thread(work, t));
+	work(0);
+	for (int t{ 0 }; t < pool.size(); t++) pool[t].join();
+
+	double busy_time{ 0 };
+	for (int t{ 0 }; t < threads; t++) busy_time += thread_times[t];
+	asset_step_throughput = (double)N * model.steps() * model.assets() / busy_time;
+
+	// average over all paths
+	double discount = exp(-interest_rate * expiration);
+	values = std::vector<double>(M);
+	standard_errors = std::vector<double>(M);
+	for (int m{ 0 }; m < M; m++) {
+		double mean = pairwise_sum(block_sums[m], 0, blocks) / N;
+		double mean_sq = pairwise_sum(block_sums_sq[m], 0, blocks) / N;
+		values[m] = discount * mean;
+		standard_errors[m] = discount * sqrt((mean_sq - mean * mean) / (N - 1.));
+	}
+}
+
+// Neumaier sums of the payoffs and squared payoffs over one block of paths, stepped a tile of paths at a time
+// the tile holds the normals and log share prices as [asset][path] arrays, so the product with the factor is a sum of
+// factor[i][k] times a contiguous row of normals and the loop over paths vectorises; the basket average is accumulated as we go
+void basket_block_sums(const correlated_GBM& model, const std::vector<double>& weights, const double& strike_price, const int& paths,
+	const int& path_tile, std::mt19937& rnd, std::vector<double>& sums, std::vector<double>& sums_sq)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	int d = model.assets();
+	int K = model.steps();
+	int M = basket_product_names.size();
+
+	// the tile, allocated once per block
+	std::vector<double> normals(d * path_tile), log_share_prices(d * path_tile), basket_sums(path_tile);
+
+	// initalise sums to zero
+	std::vector<double> compensation(M, 0.), compensation_sq(M, 0.);
+	sums = std::vector<double>(M, 0.);
+	sums_sq = std::vector<double>(M, 0.);
+
+	// loop over the tiles of the block
+	for (int first{ 0 }; first < paths; first += path_tile) {
+		int P = std::min(path_tile, paths - first);
+
+		for (int i{ 0 }; i < d; i++) std::fill(log_share_prices.begin() + i * path_tile, log_share_prices.begin() + i * path_tile + P,
+			model.log_initial_share_price(i));
+		std::fill(basket_sums.begin(), basket_sums.begin() + P, 0.);
+
+		for (int j{ 0 }; j < K; j++) {
+
+			// normals of every asset and path of the tile for this step
+			for (int p{ 0 }; p < P; p++) {
+				for (int i{ 0 }; i < d; i++) normals[i * path_tile + p] = ND(rnd);
+			}
+
+			// correlate and step, one row of the factor at a time
+			for (int i{ 0 }; i < d; i++) {
+				double* x = &log_share_prices[i * path_tile];
+				double drift = model.drift(i);
+				for (int p{ 0 }; p < P; p++) x[p] += drift;
+				for (int k{ 0 }; k <= i; k++) {
+					double a = model.factor(i, k);
+					const double* z = &normals[k * path_tile];
+					for (int p{ 0 }; p < P; p++) x[p] += a * z[p];
+				}
+				double w = weights[i];
+				for (int p{ 0 }; p < P; p++) basket_sums[p] += w * exp(x[p]);
+			}
+		}
+
+		// add in the payoffs
+		for (int p{ 0 }; p < P; p++) {
+			double best{ 0 };
+			for (int i{ 0 }; i < d; i++) best = std::max(best, exp(log_share_prices[i * path_tile + p]));
+			double payoffs[2]{ std::max(basket_sums[p] / K - strike_price, 0.), std::max(best - strike_price, 0.) };
+			for (int m{ 0 }; m < M; m++) {
+				compensated_add(sums[m], compensation[m], payoffs[m]);
+				compensated_add(sums_sq[m], compensation_sq[m], payoffs[m] * payoffs[m]);
+			}
+		}
+	}
+	for (int m{ 0 }; m < M; m++) {
+		sums[m] += compensation[m];
+		sums_sq[m] += compensation_sq[m];
+	}
+}
+
+// lower triangular L with L L^T = matrix, false if the matrix is not positive definite
+bool Cholesky(const std::vector<std::vector<double>>& matrix, std::vector<std::vector<double>>& lower)
+{
+	int d = matrix.size();
+	lower = std::vector<std::vector<double>>(d, std::vector<double>(d, 0.));
+	for (int i{ 0 }; i < d; i++) {
+		for (int k{ 0 }; k <= i; k++) {
+			double sum = matrix[i][k];
+			for (int m{ 0 }; m < k; m++) sum -= lower[i][m] * lower[k][m];
+			if (i == k) {
+				if (sum <= 0) return false;
+				lower[i][i] = pow(sum, 0.5);
+			}
+			else lower[i][k] = sum / lower[k][k];
+		}
+	}
+	return true;
+}
+
+// exchange option max(S_1 - S_2, 0) (Margrabe), to check the correlation of the paths through max(S_1, S_2) = S_2 + max(S_1 - S_2, 0)
+double analytic_exchange_option(const double& S1, const double& S2, const double& q1, const double& q2, const double& sigma1,
+	const double& sigma2, const double& rho, const double& expiration)
+{
+	double sigma = pow(pow(sigma1, 2) + pow(sigma2, 2) - 2 * rho * sigma1 * sigma2, 0.5);
+	double d1_val = (log(S1 / S2) + (q2 - q1 + 0.5 * pow(sigma, 2)) * expiration) / (sigma * pow(expiration, 0.5));
+	double d2_val = d1_val - sigma * pow(expiration, 0.5);
+	return S1 * exp(-q1 * expiration) * norm_cumm(d1_val) - S2 * exp(-q2 * expiration) * norm_cumm(d2_val);
+}
+
+// pairwise sum of block totals in a fixed tree order
+double pairwise_sum(const std::vector<double>& values, const int& first, const int& last)
+{
+	if (last - first <= 0) return 0;
+	if (last - first == 1) return values[first];
+	int middle = first + (last - first) / 2;
+	return pairwise_sum(values, first, middle) + pairwise_sum(values, middle, last);
+}
+
+// add a value to a compensated (Neumaier) sum
+void compensated_add(double& sum, double& compensation, const double& value)
+{
+	double t = sum + value;
+	if (fabs(sum) >= fabs(value)) compensation += (sum - t) + value;
+	else compensation += (value - t) + sum;
+	sum = t;
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x)
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
@@ -0,0 +1,253 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <string>
+#include <numeric>
+
+
+// payoff accumulator fed one path at a time: start at the initial share price, step at every monitoring date, then payoff
+class path_payoff
+{
+public:
+	virtual ~path_payoff() {}
+	virtual std::string name() const = 0;
+	virtual void start(const double& share_price) = 0;
+	virtual void step(const double& share_price) = 0;
+	virtual double payoff(const double& share_price) const = 0;
+};
+
+// floating strike Asian call max(S_T - A, 0), running average
+class floating_Asian_call : public path_payoff
+{
+public:
+	std::string name() const { return "floating strike Asian call"; }
+	void start(const double& share_price) { A_sum = 0; steps = 0; }
+	void step(const double& share_price) { A_sum += share_price; steps++; }
+	double payoff(const double& share_price) const { return std::max(share_price - A_sum / steps, 0.); }
+private:
+	double A_sum{ 0 };
+	int steps{ 0 };
+};
+
+// fixed strike Asian call max(A - X, 0), running average
+class fixed_Asian_call : public path_payoff
+{
+public:
+	fixed_Asian_call(const double& strike) : strike_price(strike) {}
+	std::string name() const { return "fixed strike Asian call"; }
+	void start(const double& share_price) { A_sum = 0; steps = 0; }
+	void step(const double& share_price) { A_sum += share_price; steps++; }
+	double payoff(const double& share_price) const { return std::max(A_sum / steps - strike_price, 0.); }
+private:
+	double strike_price;
+	double A_sum{ 0 };
+	int steps{ 0 };
+};
+
+// floating strike lookback call S_T - min S, running minimum including the initial share price
+class lookback_call : public path_payoff
+{
+public:
+	std::string name() const { return "floating strike lookback call"; }
+	void start(const double& share_price) { minimum = share_price; }
+	void step(const double& share_price) { minimum = std::min(minimum, share_price); }
+	double payoff(const double& share_price) const { return share_price - minimum; }
+private:
+	double minimum{ 0 };
+};
+
+// up and out call max(S_T - X, 0) if S stays below the barrier at every monitoring date, barrier flag
+class up_and_out_call : public path_payoff
+{
+public:
+	up_and_out_call(const double& strike, const double& barrier_level) : strike_price(strike), barrier(barrier_level) {}
+	std::string name() const { return "up and out call"; }
+	void start(const double& share_price) { knocked_out = share_price >= barrier; }
+	void step(const double& share_price) { if (share_price >= barrier) knocked_out = true; }
+	double payoff(const double& share_price) const { return knocked_out ? 0 : std::max(share_price - strike_price, 0.); }
+private:
+	double strike_price, barrier;
+	bool knocked_out{ false };
+};
+
+
+// Function declerations
+
+// value every payoff in the list from one set of paths, returning values, standard errors and the correlation of the errors
+void value_path_payoffs(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const std::vector<path_payoff*>& payoffs, std::mt19937& rnd, std::vector<double>& values,
+	std::vector<double>& standard_errors, std::vector<std::vector<double>>& correlations);
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double volatility{ 0.37 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.04 };
+	double initial_share_price{ 900 };
+	int K{ 35 };  // points in the sample path
+	int N{ 500000 };  // number of MC paths
+
+	// the products on this underlying
+	floating_Asian_call floating;
+	fixed_Asian_call fixed(900);
+	lookback_call lookback;
+	up_and_out_call barrier(900, 1400);
+	std::vector<path_payoff*> payoffs{ &floating, &fixed, &lookback, &barrier };
+	int M = payoffs.size();
+
+	// one simulation per product
+	std::vector<double> separate_values, separate_errors;
+	auto start = std::chrono::steady_clock::now();  // get start time
+	for (int p{ 0 }; p < M; p++) {
+		std::mt19937 rnd(p + 1);
+		std::vector<double> values, standard_errors;
+		std::vector<std::vector<double>> correlations;
+		value_path_payoffs(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, { payoffs[p] }, rnd, values,
+			standard_errors, correlations);
+		separate_values.push_back(values[0]);
+		separate_errors.push_back(standard_errors[0]);
+	}
+	auto finish = std::chrono::steady_clock::now();  // get finish time
+	auto elapsed1 = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+	// every product from one simulation
+	std::mt19937 rnd(M + 1);
+	std::vector<double> values, standard_errors;
+	std::vector<std::vector<double>> correlations;
+	start = std::chrono::steady_clock::now();  // get start time
+	value_path_payoffs(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, payoffs, rnd, values, standard_errors,
+		correlations);
+	finish = std::chrono::steady_clock::now();  // get finish time
+	auto elapsed2 = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("multi payoff.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+
+	// report values
+	std::cout << std::setprecision(6);
+	for (int p{ 0 }; p < M; p++) {
+		double difference = (values[p] - separate_values[p]) / pow(pow(standard_errors[p], 2) + pow(separate_errors[p], 2), 0.5);
+		std::cout << std::setw(30) << payoffs[p]->name() << ": one pass = " << std::setw(10) << values[p] << " +- " << std::setw(9) << standard_errors[p]
+			<< ", separate = " << std::setw(10) << separate_values[p] << " +- " << std::setw(9) << separate_errors[p]
+			<< ", difference in standard errors = " << difference << std::endl;
+		output << payoffs[p]->name() << "," << values[p] << "," << standard_errors[p];
+		for (int q{ 0 }; q < M; q++) output << "," << correlations[p][q];
+		output << std::endl;
+	}
+	output.close();
+
+	// the errors of the one pass values are correlated, so a book holding all of them has error from the full covariance
+	std::cout << "correlation of errors:" << std::endl;
+	double book_variance{ 0 }, independent_variance{ 0 };
+	for (int p{ 0 }; p < M; p++) {
+		std::cout << "  ";
+		for (int q{ 0 }; q < M; q++) {
+			std::cout << std::setw(10) << correlations[p][q];
+			book_variance += correlations[p][q] * standard_errors[p] * standard_errors[q];
+		}
+		std::cout << std::endl;
+		independent_variance += pow(standard_errors[p], 2);
+	}
+	std::cout << "book of one of each: value = " << std::accumulate(values.begin(), values.end(), 0.) << ", standard error = " << pow(book_variance, 0.5)
+		<< " (" << pow(independent_variance, 0.5) << " if the errors were independent)" << std::endl;
+	std::cout << "separate time = " << elapsed1.count() << " s, one pass time = " << elapsed2.count() << " s, speed up = "
+		<< elapsed1.count() / elapsed2.count() << std::endl;
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// value every payoff in the list from one set of paths, returning values, standard errors and the correlation of the errors
+// each path is generated once and fed to every accumulator, the sums of products of payoffs give the covariance of the estimates
+void value_path_payoffs(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const std::vector<path_payoff*>& payoffs, std::mt19937& rnd, std::vector<double>& values,
+	std::vector<double>& standard_errors, std::vector<std::vector<double>>& correlations)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+	double log_initial_share_price = log(initial_share_price);
+	int M = payoffs.size();
+
+	// initalise sums to zero
+	std::vector<double> sums(M, 0.), path_payoffs(M, 0.);
+	std::vector<std::vector<double>> sum_products(M, std::vector<double>(M, 0.));
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		// step the path once, feeding every accumulator
+		for (int p{ 0 }; p < M; p++) payoffs[p]->start(initial_share_price);
+		double log_share_price = log_initial_share_price;
+		double share_price{ initial_share_price };
+		for (int j{ 0 }; j < K; j++) {
+			log_share_price += drift + diffusion * ND(rnd);
+			share_price = exp(log_share_price);
+			for (int p{ 0 }; p < M; p++) payoffs[p]->step(share_price);
+		}
+
+		// add in the payoffs
+		for (int p{ 0 }; p < M; p++) {
+			path_payoffs[p] = payoffs[p]->payoff(share_price);
+			sums[p] += path_payoffs[p];
+		}
+		for (int p{ 0 }; p < M; p++) {
+			for (int q{ p }; q < M; q++) sum_products[p][q] += path_payoffs[p] * path_payoffs[q];
+		}
+	}
+
+	// average over all paths
+	double discount = exp(-interest_rate * expiration);
+	values = std::vector<double>(M);
+	standard_errors = std::vector<double>(M);
+	correlations = std::vector<std::vector<double>>(M, std::vector<double>(M, 0.));
+	std::vector<std::vector<double>> covariance(M, std::vector<double>(M, 0.));
+	for (int p{ 0 }; p < M; p++) {
+		for (int q{ p }; q < M; q++) {
+			covariance[p][q] = sum_products[p][q] / N - (sums[p] / N) * (sums[q] / N);
+			covariance[q][p] = covariance[p][q];
+		}
+	}
+	for (int p{ 0 }; p < M; p++) {
+		values[p] = discount * sums[p] / N;
+		standard_errors[p] = discount * pow(covariance[p][p] / (N - 1.), 0.5);
+		for (int q{ 0 }; q < M; q++) {
+			double scale = pow(covariance[p][p] * covariance[q][q], 0.5);
+			correlations[p][q] = (scale > 0) ? covariance[p][q] / scale : 0;
+		}
+	}
+}
@@ -0,0 +1,336 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <string>
+#include <limits>
+#include <cstdio>
+
+
+// Function declerations
+
+// value Asian call with antithetic paths, saving progress to a checkpoint file every checkpoint_interval paths
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, std::mt19937& rnd, std::normal_distribution<double>& ND,
+	const std::string& checkpoint_file, const int& checkpoint_interval);
+
+// write the state of a run to a checkpoint file
+void write_run_checkpoint(const std::string& checkpoint_file, const int& N, const double& K, const int& paths_done, const double& sum,
+	const std::mt19937& rnd, const std::normal_distribution<double>& ND);
+
+// read the state of a run from a checkpoint file, returns false if there is no matching checkpoint
+bool read_run_checkpoint(const std::string& checkpoint_file, const int& N, const double& K, int& paths_done, double& sum,
+	std::mt19937& rnd, std::normal_distribution<double>& ND);
+
+// write the state of the sweep to a checkpoint file
+void write_sweep_checkpoint(const std::string& checkpoint_file, const int& repetition, const std::vector<std::vector<double>>& master_time_store,
+	const std::vector<std::vector<double>>& master_value_store, const std::mt19937& rnd, const std::normal_distribution<double>& ND);
+
+// read the state of the sweep from a checkpoint file, returns false if there is no checkpoint
+bool read_sweep_checkpoint(const std::string& checkpoint_file, int& repetition, std::vector<std::vector<double>>& master_time_store,
+	std::vector<std::vector<double>>& master_value_store, std::mt19937& rnd, std::normal_distribution<double>& ND);
+
+// replace a file with a freshly written temporary so a kill never leaves a half written checkpoint
+void replace_file(const std::string& temporary_file, const std::string& file);
+
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double volatility{ 0.37 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.04 };
+	double initial_share_price{ 900 };
+	double K{ 35 };  // points in the sample path
+
+	// checkpoint settings
+	std::string sweep_checkpoint{ "path_dep_antithetic_sweep.chk" };
+	std::string run_checkpoint{ "path_dep_antithetic_run.chk" };
+	int checkpoint_interval{ 100000 };  // paths between run checkpoints
+
+	// random number generator and normal distribution shared by every run
+	std::mt19937 rnd;
+	std::normal_distribution<double> ND(0., 1.);
+
+	// containers
+	std::vector<double> N_store;
+	std::vector<std::vector<double>> master_time_store;
+	std::vector<std::vector<double>> master_value_store;
+	for (int N{ 100000 }; N <= 1500000; N += 100000) N_store.push_back(N);
+
+	// resume a killed sweep
+	int repetition{ 0 };
+	if (read_sweep_checkpoint(sweep_checkpoint, repetition, master_time_store, master_value_store, rnd, ND)) {
+		std::cout << "Resuming from repetition " << repetition << ", N = " << N_store[master_time_store.back().size() % N_store.size()] << std::endl;
+	}
+
+	// loop over number of calculations
+	for (; repetition < 100; repetition++) {
+
+		// start a new repetition unless resuming part way through one
+		if (master_time_store.empty() || master_time_store.back().size() == N_store.size()) {
+			master_time_store.push_back(std::vector<double>());
+			master_value_store.push_back(std::vector<double>());
+		}
+
+		for (int j = master_time_store.back().size(); j < N_store.size(); j++) {
+
+			int N = N_store[j];
+
+			auto start = std::chrono::steady_clock::now();  // get start time
+			double value = value_Asian_call(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, rnd, ND,
+				run_checkpoint, checkpoint_interval);
+			auto finish = std::chrono::steady_clock::now();  // get finish time
+			auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+			master_time_store.back().push_back(elapsed.count());
+			master_value_store.back().push_back(value);
+
+			// record the completed run
+			int completed = master_time_store.back().size() == N_store.size() ? repetition + 1 : repetition;
+			write_sweep_checkpoint(sweep_checkpoint, completed, master_time_store, master_value_store, rnd, ND);
+		}
+	}
+
+	// calculate average
+	std::vector<double> average, average_value;
+	for (int i{ 0 }; i < N_store.size(); i++) {
+
+		double sum{ 0 }, sum_value{ 0 };
+
+		for (int j{ 0 }; j < master_time_store.size(); j++) {
+			sum += master_time_store[j][i];
+			sum_value += master_value_store[j][i];
+		}
+
+		average.push_back(sum / master_time_store.size());
+		average_value.push_back(sum_value / master_value_store.size());
+	}
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("path dep antithetic.csv");
+
+	// if the file is open
+	if (output.is_open()) {
+
+		// loop over data containers
+		for (int i{ 0 }; i < N_store.size(); i++) {
+
+			// write data to file
+			output << std::setprecision(std::numeric_limits<double>::max_digits10) << N_store[i] << "," << average[i] << "," << average_value[i] << std::endl;
+		}
+
+		// close the file
+		std::cout << "File write successful" << std::endl;
+		output.close();
+
+		// the sweep is finished so the checkpoint is no longer needed
+		std::remove(sweep_checkpoint.c_str());
+	}
+	// if file could not be opened
+	else {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// value Asian call with antithetic paths, saving progress to a checkpoint file every checkpoint_interval paths
+// a run resumed from its checkpoint continues the same random number stream and gives a bitwise identical result
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, std::mt19937& rnd, std::normal_distribution<double>& ND,
+	const std::string& checkpoint_file, const int& checkpoint_interval)
+{
+	// initalise sum to zero, or pick up where a killed run left off
+	double sum{ 0 };
+	int paths_done{ 0 };
+	read_run_checkpoint(checkpoint_file, N, K, paths_done, sum, rnd, ND);
+
+	// time step
+	double dt{ expiration / K };
+
+	// loop over all MC paths
+	for (int i{ paths_done }; i < N; i++) {
+
+		// save progress
+		if (i > paths_done && i % checkpoint_interval == 0) write_run_checkpoint(checkpoint_file, N, K, i, sum, rnd, ND);
+
+		// running values of the two stock paths
+		double share_price1{ initial_share_price }, share_price2{ initial_share_price };
+		double A1_sum{ 0 }, A2_sum{ 0 };
+
+		// generate stock path
+		for (int j{ 1 }; j <= K; j++) {
+
+			// generate random number
+			double phi = ND(rnd);
+
+			// gemerate stock path
+			share_price1 *= exp((interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt + volatility * phi * pow(dt, 0.5));
+			share_price2 *= exp((interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt - volatility * phi * pow(dt, 0.5));
+			A1_sum += share_price1;
+			A2_sum += share_price2;
+		}
+
+		// add in the payoff
+		sum += std::max(share_price1 - A1_sum / K, 0.);
+		sum += std::max(share_price2 - A2_sum / K, 0.);
+	}
+
+	// the run is finished so the checkpoint is no longer needed
+	std::remove(checkpoint_file.c_str());
+
+	// average over all paths
+	return exp(-interest_rate * expiration) * sum / (2. * N);
+}
+
+// write the state of a run to a checkpoint file
+void write_run_checkpoint(const std::string& checkpoint_file, const int& N, const double& K, const int& paths_done, const double& sum,
+	const std::mt19937& rnd, const std::normal_distribution<double>& ND)
+{
+	// open a file stream for writing
+	std::string temporary_file = checkpoint_file + ".tmp";
+	std::ofstream output(temporary_file);
+
+	// if file could not be opened carry on without a checkpoint
+	if (!output.is_open()) {
+		std::cout << "Error: could not open checkpoint file" << std::endl;
+		return;
+	}
+
+	// write the accumulators at full precision and the generator state
+	output << std::setprecision(std::numeric_limits<double>::max_digits10);
+	output << N << " " << K << " " << paths_done << " " << sum << std::endl;
+	output << rnd << std::endl;
+	output << ND << std::endl;
+	output.close();
+
+	replace_file(temporary_file, checkpoint_file);
+}
+
+// read the state of a run from a checkpoint file, returns false if there is no matching checkpoint
+bool read_run_checkpoint(const std::string& checkpoint_file, const int& N, const double& K, int& paths_done, double& sum,
+	std::mt19937& rnd, std::normal_distribution<double>& ND)
+{
+	// open a file stream for reading
+	std::ifstream input(checkpoint_file);
+	if (!input.is_open()) input.open(checkpoint_file + ".tmp");
+	if (!input.is_open()) return false;
+
+	// only resume a checkpoint written by a run with the same parameters
+	int checkpoint_N;
+	double checkpoint_K;
+	int checkpoint_paths_done;
+	double checkpoint_sum;
+	std::mt19937 checkpoint_rnd;
+	std::normal_distribution<double> checkpoint_ND;
+	input >> checkpoint_N >> checkpoint_K >> checkpoint_paths_done >> checkpoint_sum >> checkpoint_rnd >> checkpoint_ND;
+	if (input.fail() || checkpoint_N != N || checkpoint_K != K) return false;
+
+	paths_done = checkpoint_paths_done;
+	sum = checkpoint_sum;
+	rnd = checkpoint_rnd;
+	ND = checkpoint_ND;
+
+	return true;
+}
+
+// write the state of the sweep to a checkpoint file
+void write_sweep_checkpoint(const std::string& checkpoint_file, const int& repetition, const std::vector<std::vector<double>>& master_time_store,
+	const std::vector<std::vector<double>>& master_value_store, const std::mt19937& rnd, const std::normal_distribution<double>& ND)
+{
+	// open a file stream for writing
+	std::string temporary_file = checkpoint_file + ".tmp";
+	std::ofstream output(temporary_file);
+
+	// if file could not be opened carry on without a checkpoint
+	if (!output.is_open()) {
+		std::cout << "Error: could not open checkpoint file" << std::endl;
+		return;
+	}
+
+	// write the completed results at full precision and the generator state
+	output << std::setprecision(std::numeric_limits<double>::max_digits10);
+	output << repetition << " " << master_time_store.size() << std::endl;
+	for (int i{ 0 }; i < master_time_store.size(); i++) {
+		output << master_time_store[i].size();
+		for (int j{ 0 }; j < master_time_store[i].size(); j++) output << " " << master_time_store[i][j] << " " << master_value_store[i][j];
+		output << std::endl;
+	}
+	output << rnd << std::endl;
+	output << ND << std::endl;
+	output.close();
+
+	replace_file(temporary_file, checkpoint_file);
+}
+
+// read the state of the sweep from a checkpoint file, returns false if there is no checkpoint
+bool read_sweep_checkpoint(const std::string& checkpoint_file, int& repetition, std::vector<std::vector<double>>& master_time_store,
+	std::vector<std::vector<double>>& master_value_store, std::mt19937& rnd, std::normal_distribution<double>& ND)
+{
+	// open a file stream for reading
+	std::ifstream input(checkpoint_file);
+	if (!input.is_open()) input.open(checkpoint_file + ".tmp");
+	if (!input.is_open()) return false;
+
+	// read the completed results
+	int checkpoint_repetition, rows;
+	input >> checkpoint_repetition >> rows;
+	std::vector<std::vector<double>> time_store(rows), value_store(rows);
+	for (int i{ 0 }; i < rows && input; i++) {
+		int columns{ 0 };
+		input >> columns;
+		time_store[i].resize(columns);
+		value_store[i].resize(columns);
+		for (int j{ 0 }; j < columns; j++) input >> time_store[i][j] >> value_store[i][j];
+	}
+
+	// read the generator state
+	std::mt19937 checkpoint_rnd;
+	std::normal_distribution<double> checkpoint_ND;
+	input >> checkpoint_rnd >> checkpoint_ND;
+	if (input.fail()) return false;
+
+	repetition = checkpoint_repetition;
+	master_time_store = time_store;
+	master_value_store = value_store;
+	rnd = checkpoint_rnd;
+	ND = checkpoint_ND;
+
+	return true;
+}
+
+// replace a file with a freshly written temporary so a kill never leaves a half written checkpoint
+void replace_file(const std::string& temporary_file, const std::string& file)
+{
+	// rename will not overwrite an existing file on every platform, readers fall back to the temporary if the rename is interrupted
+	if (std::rename(temporary_file.c_str(), file.c_str()) == 0) return;
+	std::remove(file.c_str());
+	if (std::rename(temporary_file.c_str(), file.c_str()) != 0) std::cout << "Error: could not write checkpoint file" << std::endl;
+}
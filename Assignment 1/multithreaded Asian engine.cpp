@@ -0,0 +1,244 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <atomic>
+
+
+// number of paths in a block, each block has its own generator stream and is the unit of work handed to threads
+// small next to the smallest N of the path dependence sweep, so its cells still split across threads, and fixed so the
+// value never depends on the number of threads
+const int Asian_block{ 256 };
+
+
+// Function declerations
+
+// value Asian call over path blocks on several threads, each block with its own random number stream
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, const unsigned int& seed, const int& threads, double& standard_error,
+	std::vector<double>& thread_throughput);
+
+// Neumaier sums of the payoff and squared payoff over one block of paths
+void Asian_block_sums(const double& initial_share_price, const double& drift, const double& diffusion, const double& K, const int& paths,
+	std::mt19937& rnd, double& sum, double& sum_sq);
+
+// pairwise sum of block totals in a fixed tree order
+double pairwise_sum(const std::vector<double>& values, const int& first, const int& last);
+
+// add a value to a compensated (Neumaier) sum
+void compensated_add(double& sum, double& compensation, const double& value);
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double volatility{ 0.37 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.04 };
+	double initial_share_price{ 900 };
+	double K{ 35 };  // points in the sample path
+	int N{ 1500000 };  // number of MC paths
+	unsigned int seed{ 20210318 };
+	int max_threads = std::max(1u, std::thread::hardware_concurrency());
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("multithreaded Asian.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+	std::cout << std::setprecision(10);
+
+	// scaling of the 1.5M path run, the value must not depend on the number of threads
+	double value_1{ 0 }, time_1{ 0 };
+	for (int threads{ 1 }; threads <= std::max(4, max_threads); threads *= 2) {
+
+		double standard_error;
+		std::vector<double> thread_throughput;
+		auto start = std::chrono::steady_clock::now();  // get start time
+		double value = value_Asian_call(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, seed, threads,
+			standard_error, thread_throughput);
+		auto finish = std::chrono::steady_clock::now();  // get finish time
+		auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+		if (threads == 1) {
+			value_1 = value;
+			time_1 = elapsed.count();
+		}
+		double min_throughput = *std::min_element(thread_throughput.begin(), thread_throughput.end());
+		double max_throughput = *std::max_element(thread_throughput.begin(), thread_throughput.end());
+
+		std::cout << "threads = " << std::setw(3) << threads << ": V = " << value << " +- " << standard_error << ", time = " << elapsed.count()
+			<< " s, speed up = " << time_1 / elapsed.count() << ", paths per second per thread = " << min_throughput << " to " << max_throughput
+			<< ", identical to 1 thread = " << (value == value_1 ? "yes" : "no") << std::endl;
+		output << threads << "," << value << "," << standard_error << "," << elapsed.count() << "," << min_throughput << "," << max_throughput << std::endl;
+
+		// stop doubling once past the cores of the machine
+		if (threads >= max_threads && threads >= 4) break;
+	}
+	output.close();
+
+	// the N x K path dependence sweep of 3D mutliple path dependence.cpp on all threads
+	output.open("path dependence multithreaded.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+	for (int N{ 1000 }; N <= 2000; N += 1000) {
+		for (int K{ 20 }; K <= 200; K += 20) {
+
+			double standard_error;
+			std::vector<double> thread_throughput;
+			auto start = std::chrono::steady_clock::now();  // get start time
+			double value = value_Asian_call(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, seed, max_threads,
+				standard_error, thread_throughput);
+			auto finish = std::chrono::steady_clock::now();  // get finish time
+			auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+			output << N << "," << K << "," << value << "," << elapsed.count() << "," << standard_error << std::endl;
+		}
+	}
+	std::cout << "File write successful" << std::endl;
+	output.close();
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// value Asian call over path blocks on several threads, each block with its own random number stream
+// block b always holds paths [b * Asian_block, (b + 1) * Asian_block) and draws from a generator seeded by (seed, b), threads
+// take the next free block, and the block totals are combined in a fixed tree, so the value is bitwise identical for any
+// number of threads; thread_throughput returns the paths per second of each thread while it was working
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const double& K, const unsigned int& seed, const int& threads, double& standard_error,
+	std::vector<double>& thread_throughput)
+{
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+
+	// one total per block
+	int blocks = (N + Asian_block - 1) / Asian_block;
+	std::vector<double> block_sums(blocks, 0.), block_sums_sq(blocks, 0.);
+	std::vector<long long> thread_paths(threads, 0);
+	std::vector<double> thread_times(threads, 0.);
+	std::atomic<int> next_block{ 0 };
+
+	// each thread takes the next free block until none are left
+	auto work = [&](const int& thread) {
+		auto start = std::chrono::steady_clock::now();  // get start time
+		for (int b = next_block++; b < blocks; b = next_block++) {
+
+			// the generator of this block
+			std::seed_seq block_seed{ seed, (unsigned int)b };
+			std::mt19937 rnd(block_seed);
+
+			// sums are kept locally and stored once, so neighbouring blocks on other threads do not share a cache line while running
+			int paths = std::min(Asian_block, N - b * Asian_block);
+			double sum, sum_sq;
+			Asian_block_sums(initial_share_price, drift, diffusion, K, paths, rnd, sum, sum_sq);
+			block_sums[b] = sum;
+			block_sums_sq[b] = sum_sq;
+			thread_paths[thread] += paths;
+		}
+		auto finish = std::chrono::steady_clock::now();  // get finish time
+		thread_times[thread] = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start).count();
+	};
+
+	// run the blocks
+	std::vector<std::thread> pool;
+	for (int t{ 1 }; t < threads; t++) pool.push_back(std::thread(work, t));
+	work(0);
+	for (int t{ 0 }; t < pool.size(); t++) pool[t].join();
+
+	// throughput of each thread
+	thread_throughput.clear();
+	for (int t{ 0 }; t < threads; t++) thread_throughput.push_back(thread_times[t] > 0 ? thread_paths[t] / thread_times[t] : 0);
+
+	// average over all paths
+	double mean = pairwise_sum(block_sums, 0, blocks) / N;
+	double mean_sq = pairwise_sum(block_sums_sq, 0, blocks) / N;
+	standard_error = exp(-interest_rate * expiration) * sqrt((mean_sq - mean * mean) / (N - 1.));
+	return exp(-interest_rate * expiration) * mean;
+}
+
+// Neumaier sums of the payoff and squared payoff over one block of paths
+// each path keeps only the running log share price and running sum
+void Asian_block_sums(const double& initial_share_price, const double& drift, const double& diffusion, const double& K, const int& paths,
+	std::mt19937& rnd, double& sum, double& sum_sq)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	double log_initial_share_price = log(initial_share_price);
+	int steps = (int)K;
+
+	// initalise sums to zero
+	double sum_compensation{ 0 }, sum_sq_compensation{ 0 };
+	sum = 0;
+	sum_sq = 0;
+
+	// loop over the paths of the block
+	for (int i{ 0 }; i < paths; i++) {
+
+		// step the path, accumulating the average as we go
+		double log_share_price = log_initial_share_price;
+		double share_price{ initial_share_price };
+		double A_sum{ 0 };
+		for (int j{ 0 }; j < steps; j++) {
+			log_share_price += drift + diffusion * ND(rnd);
+			share_price = exp(log_share_price);
+			A_sum += share_price;
+		}
+
+		// add in the payoff
+		double payoff = std::max(share_price - A_sum / K, 0.);
+		compensated_add(sum, sum_compensation, payoff);
+		compensated_add(sum_sq, sum_sq_compensation, payoff * payoff);
+	}
+	sum += sum_compensation;
+	sum_sq += sum_sq_compensation;
+}
+
+// pairwise sum of block totals in a fixed tree order
+double pairwise_sum(const std::vector<double>& values, const int& first, const int& last)
+{
+	if (last - first <= 0) return 0;
+	if (last - first == 1) return values[first];
+	int middle = first + (last - first) / 2;
+	return pairwise_sum(values, first, middle) + pairwise_sum(values, middle, last);
+}
+
+// add a value to a compensated (Neumaier) sum
+void compensated_add(double& sum, double& compensation, const double& value)
+{
+	double t = sum + value;
+	if (fabs(sum) >= fabs(value)) compensation += (sum - t) + value;
+	else compensation += (value - t) + sum;
+	sum = t;
+}
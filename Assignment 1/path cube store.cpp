@@ -0,0 +1,433 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <string>
+#include <cstring>
+#include <climits>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+// number of paths in a tile, a tile is stored as [step][path] so a payoff reads each step of the tile contiguously
+const int cube_tile{ 256 };
+
+// the data of a cube starts here, after the header
+const int cube_data_offset{ 128 };
+
+// models that can write a cube
+const std::vector<std::string> cube_model_names{ "GBM" };
+
+
+// header at the start of a path cube file, describing the model, seed and grid of the share prices that follow
+// the data is ceil(N / tile) tiles of K x tile values of S(t_1) ... S(t_K) in float or double, the last tile padded with zeros
+struct path_cube_header
+{
+	char magic[8];  // "PATHCUBE"
+	int version;
+	int model;  // index into cube_model_names
+	int element_size;  // 4 for float, 8 for double
+	int tile;
+	long long N, K;
+	unsigned long long seed;
+	double initial_share_price, interest_rate, dividend_rate, volatility, expiration;
+};
+
+// read only memory map of a path cube file
+class path_cube_reader
+{
+public:
+	path_cube_reader(const std::string& filename);
+	~path_cube_reader();
+	path_cube_reader(const path_cube_reader&) = delete;
+	path_cube_reader& operator=(const path_cube_reader&) = delete;
+	bool is_open() const { return data != nullptr; }
+	const path_cube_header& header() const { return *(const path_cube_header*)data; }
+	int tiles() const { return (int)((header().N + header().tile - 1) / header().tile); }
+	long long bytes() const { return size; }
+
+	// values of tile t, element [j * tile + p] is S(t_(j+1)) of path t * tile + p
+	template <typename real>
+	const real* tile_data(const int& t) const { return (const real*)(data + cube_data_offset) + (size_t)t * header().K * header().tile; }
+private:
+	void unmap();
+	const char* data{ nullptr };
+	long long size{ 0 };
+#ifdef _WIN32
+	HANDLE file{ INVALID_HANDLE_VALUE }, mapping{ NULL };
+#endif
+};
+
+
+// Function declerations
+
+// simulate N GBM paths of K steps and write them to a path cube file in float or double
+bool write_path_cube(const std::string& filename, const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const int& K, const unsigned long long& seed, const bool& single_precision);
+
+// one tile of GBM share prices as [step][path], the same for the writer and for direct pricing
+void GBM_tile(const double& initial_share_price, const double& drift, const double& diffusion, const int& K, const int& paths, std::mt19937_64& rnd,
+	std::vector<double>& tile);
+
+// value Asian call by simulating the paths of a cube without storing them
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const unsigned long long& seed, double& standard_error);
+
+// value the floating strike Asian call, fixed strike Asian call and floating strike lookback call over the stored paths
+template <typename real>
+void value_from_cube(const path_cube_reader& cube, const double& strike_price, std::vector<double>& values, std::vector<double>& standard_errors);
+
+// mean, variance, skew and kurtosis of the standardised log increments of the stored paths, which should be those of N(0, 1)
+template <typename real>
+std::vector<double> normal_test(const path_cube_reader& cube);
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double volatility{ 0.37 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.04 };
+	double initial_share_price{ 900 };
+	int K{ 35 };  // points in the sample path
+	int N{ 500000 };  // number of MC paths
+	unsigned long long seed{ 20210318 };
+	std::cout << std::setprecision(10);
+
+	// pricing by simulation
+	double direct_error;
+	auto start = std::chrono::steady_clock::now();  // get start time
+	double direct = value_Asian_call(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, seed, direct_error);
+	auto finish = std::chrono::steady_clock::now();  // get finish time
+	double simulate_time = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start).count();
+	std::cout << "simulated: V = " << direct << " +- " << direct_error << ", time = " << simulate_time << " s" << std::endl;
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("path cube.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+	output << "precision,file size,write time,read time,floating Asian,fixed Asian,lookback,bandwidth" << std::endl;
+
+	for (int single_precision{ 0 }; single_precision < 2; single_precision++) {
+
+		// write the cube once
+		std::string filename = single_precision ? "paths float.cube" : "paths double.cube";
+		start = std::chrono::steady_clock::now();  // get start time
+		if (!write_path_cube(filename, initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, seed, single_precision)) {
+			std::cout << "Error: could not open file" << std::endl;
+			return 1;
+		}
+		finish = std::chrono::steady_clock::now();  // get finish time
+		double write_time = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start).count();
+
+		// and price every payoff over the mapped paths, in the precision the header says the cube holds
+		path_cube_reader cube(filename);
+		if (!cube.is_open()) {
+			std::cout << "Error: could not map " << filename << std::endl;
+			return 1;
+		}
+		bool stored_float = cube.header().element_size == 4;
+		std::vector<double> values, standard_errors, moments;
+		start = std::chrono::steady_clock::now();  // get start time
+		if (stored_float) value_from_cube<float>(cube, 900, values, standard_errors);
+		else value_from_cube<double>(cube, 900, values, standard_errors);
+		finish = std::chrono::steady_clock::now();  // get finish time
+		double read_time = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start).count();
+		moments = stored_float ? normal_test<float>(cube) : normal_test<double>(cube);
+
+		const path_cube_header& header = cube.header();
+		std::cout << filename << ": model = " << cube_model_names[header.model] << ", seed = " << header.seed << ", N = " << header.N << ", K = "
+			<< header.K << ", " << cube.bytes() / 1e6 << " MB, write time = " << write_time << " s" << std::endl;
+		std::cout << "  floating strike Asian call = " << values[0] << " +- " << standard_errors[0] << " (difference to simulated "
+			<< values[0] - direct << ")" << std::endl;
+		std::cout << "  fixed strike Asian call    = " << values[1] << " +- " << standard_errors[1] << std::endl;
+		std::cout << "  floating lookback call     = " << values[2] << " +- " << standard_errors[2] << std::endl;
+		std::cout << "  three payoffs in " << read_time << " s (" << cube.bytes() / read_time / 1e9 << " GB/s), one payoff by simulation takes "
+			<< simulate_time << " s" << std::endl;
+		std::cout << "  log increments: mean = " << moments[0] << ", variance = " << moments[1] << ", skew = " << moments[2] << ", kurtosis = "
+			<< moments[3] << std::endl;
+		output << (stored_float ? "float" : "double") << "," << cube.bytes() << "," << write_time << "," << read_time << "," << values[0] << ","
+			<< values[1] << "," << values[2] << "," << cube.bytes() / read_time << std::endl;
+	}
+	output.close();
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// read only memory map of a path cube file, left closed if the file cannot be mapped or its header or size do not match
+path_cube_reader::path_cube_reader(const std::string& filename)
+{
+	const char* mapped{ nullptr };
+#ifdef _WIN32
+	file = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE) return;
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(file, &file_size)) return;
+	size = file_size.QuadPart;
+	mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping == NULL) return;
+	mapped = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (mapped == NULL) return;
+#else
+	int descriptor = open(filename.c_str(), O_RDONLY);
+	if (descriptor < 0) return;
+	struct stat status;
+	if (fstat(descriptor, &status) != 0) {
+		close(descriptor);
+		return;
+	}
+	size = status.st_size;
+	void* address = (size >= cube_data_offset) ? mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0) : MAP_FAILED;
+	close(descriptor);
+	if (address == MAP_FAILED) return;
+	mapped = (const char*)address;
+#endif
+
+	// check every field of the header before it is used, then the header against the size of the file, the readers index
+	// inside a tile with cube_tile so only cubes of that tile size are accepted
+	data = mapped;
+	if (size < cube_data_offset) {
+		unmap();
+		return;
+	}
+	const path_cube_header& h = *(const path_cube_header*)mapped;
+	bool valid = memcmp(h.magic, "PATHCUBE", 8) == 0 && h.version == 1 && h.model >= 0 && h.model < (int)cube_model_names.size()
+		&& (h.element_size == 4 || h.element_size == 8) && h.tile == cube_tile && h.N > 0 && h.K > 0 && h.N <= INT_MAX && h.K <= INT_MAX
+		&& h.K <= (size - cube_data_offset) / ((long long)cube_tile * h.element_size);
+	if (valid) {
+		long long tiles = (h.N + cube_tile - 1) / cube_tile;
+		valid = size == cube_data_offset + tiles * h.K * cube_tile * h.element_size;
+	}
+	if (!valid) unmap();
+}
+
+path_cube_reader::~path_cube_reader()
+{
+	unmap();
+}
+
+// release the mapping and any handles
+void path_cube_reader::unmap()
+{
+#ifdef _WIN32
+	if (data != nullptr) UnmapViewOfFile(data);
+	if (mapping != NULL) CloseHandle(mapping);
+	if (file != INVALID_HANDLE_VALUE) CloseHandle(file);
+	mapping = NULL;
+	file = INVALID_HANDLE_VALUE;
+#else
+	if (data != nullptr) munmap((void*)data, size);
+#endif
+	data = nullptr;
+}
+
+// simulate N GBM paths of K steps and write them to a path cube file in float or double
+// paths are written a tile at a time, so the cube is never held in memory
+bool write_path_cube(const std::string& filename, const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const int& K, const unsigned long long& seed, const bool& single_precision)
+{
+	std::ofstream file(filename, std::ios::binary);
+	if (!file.is_open()) return false;
+
+	// the header, padded to the start of the data
+	path_cube_header header{};
+	memcpy(header.magic, "PATHCUBE", 8);
+	header.version = 1;
+	header.model = 0;
+	header.element_size = single_precision ? 4 : 8;
+	header.tile = cube_tile;
+	header.N = N;
+	header.K = K;
+	header.seed = seed;
+	header.initial_share_price = initial_share_price;
+	header.interest_rate = interest_rate;
+	header.dividend_rate = dividend_rate;
+	header.volatility = volatility;
+	header.expiration = expiration;
+	std::vector<char> padded(cube_data_offset, 0);
+	memcpy(padded.data(), &header, sizeof(header));
+	file.write(padded.data(), cube_data_offset);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+
+	std::mt19937_64 rnd(seed);
+	std::vector<double> tile(K * cube_tile);
+	std::vector<float> tile_float(K * cube_tile);
+	for (int first{ 0 }; first < N; first += cube_tile) {
+		GBM_tile(initial_share_price, drift, diffusion, K, std::min(cube_tile, N - first), rnd, tile);
+		if (single_precision) {
+			for (int n{ 0 }; n < K * cube_tile; n++) tile_float[n] = (float)tile[n];
+			file.write((const char*)tile_float.data(), tile_float.size() * sizeof(float));
+		}
+		else file.write((const char*)tile.data(), tile.size() * sizeof(double));
+	}
+	return file.good();
+}
+
+// one tile of GBM share prices as [step][path], the same for the writer and for direct pricing
+// paths beyond the end of the last tile are zero
+void GBM_tile(const double& initial_share_price, const double& drift, const double& diffusion, const int& K, const int& paths, std::mt19937_64& rnd,
+	std::vector<double>& tile)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	std::fill(tile.begin(), tile.end(), 0.);
+	for (int p{ 0 }; p < paths; p++) {
+		double log_share_price = log(initial_share_price);
+		for (int j{ 0 }; j < K; j++) {
+			log_share_price += drift + diffusion * ND(rnd);
+			tile[j * cube_tile + p] = exp(log_share_price);
+		}
+	}
+}
+
+// value Asian call by simulating the paths of a cube without storing them
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const unsigned long long& seed, double& standard_error)
+{
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+
+	std::mt19937_64 rnd(seed);
+	std::vector<double> tile(K * cube_tile);
+
+	// initalise sums to zero
+	double sum{ 0 }, sum_sq{ 0 };
+
+	for (int first{ 0 }; first < N; first += cube_tile) {
+		int paths = std::min(cube_tile, N - first);
+		GBM_tile(initial_share_price, drift, diffusion, K, paths, rnd, tile);
+		for (int p{ 0 }; p < paths; p++) {
+			double A_sum{ 0 };
+			for (int j{ 0 }; j < K; j++) A_sum += tile[j * cube_tile + p];
+			double payoff = std::max(tile[(K - 1) * cube_tile + p] - A_sum / K, 0.);
+			sum += payoff;
+			sum_sq += payoff * payoff;
+		}
+	}
+
+	// average over all paths
+	double mean = sum / N;
+	standard_error = exp(-interest_rate * expiration) * sqrt((sum_sq / N - mean * mean) / (N - 1.));
+	return exp(-interest_rate * expiration) * mean;
+}
+
+// value the floating strike Asian call, fixed strike Asian call and floating strike lookback call over the stored paths
+// each tile is read step by step, accumulating the running sum and minimum of all its paths at once
+template <typename real>
+void value_from_cube(const path_cube_reader& cube, const double& strike_price, std::vector<double>& values, std::vector<double>& standard_errors)
+{
+	const path_cube_header& header = cube.header();
+	int K = header.K, N = header.N;
+	std::vector<double> A_sums(cube_tile), minimums(cube_tile);
+
+	// initalise sums to zero
+	std::vector<double> sums(3, 0.), sums_sq(3, 0.);
+
+	for (int t{ 0 }; t < cube.tiles(); t++) {
+		const real* tile = cube.tile_data<real>(t);
+		int paths = std::min(cube_tile, N - t * cube_tile);
+
+		std::fill(A_sums.begin(), A_sums.end(), 0.);
+		std::fill(minimums.begin(), minimums.end(), header.initial_share_price);
+		for (int j{ 0 }; j < K; j++) {
+			const real* step = tile + j * cube_tile;
+			for (int p{ 0 }; p < paths; p++) {
+				A_sums[p] += step[p];
+				minimums[p] = std::min(minimums[p], (double)step[p]);
+			}
+		}
+
+		// add in the payoffs
+		const real* terminal = tile + (K - 1) * cube_tile;
+		for (int p{ 0 }; p < paths; p++) {
+			double payoffs[3]{ std::max(terminal[p] - A_sums[p] / K, 0.), std::max(A_sums[p] / K - strike_price, 0.), terminal[p] - minimums[p] };
+			for (int m{ 0 }; m < 3; m++) {
+				sums[m] += payoffs[m];
+				sums_sq[m] += payoffs[m] * payoffs[m];
+			}
+		}
+	}
+
+	// average over all paths
+	double discount = exp(-header.interest_rate * header.expiration);
+	values = std::vector<double>(3);
+	standard_errors = std::vector<double>(3);
+	for (int m{ 0 }; m < 3; m++) {
+		double mean = sums[m] / N;
+		values[m] = discount * mean;
+		standard_errors[m] = discount * sqrt((sums_sq[m] / N - mean * mean) / (N - 1.));
+	}
+}
+
+// mean, variance, skew and kurtosis of the standardised log increments of the stored paths, which should be those of N(0, 1)
+// the diagnostics normal_test.csv was written for, computed from the cube instead of a text file
+template <typename real>
+std::vector<double> normal_test(const path_cube_reader& cube)
+{
+	const path_cube_header& header = cube.header();
+	int K = header.K, N = header.N;
+	double dt = header.expiration / K;
+	double drift = (header.interest_rate - header.dividend_rate - 0.5 * pow(header.volatility, 2)) * dt;
+	double diffusion = header.volatility * pow(dt, 0.5);
+
+	std::vector<double> power_sums(5, 0.);
+	for (int t{ 0 }; t < cube.tiles(); t++) {
+		const real* tile = cube.tile_data<real>(t);
+		int paths = std::min(cube_tile, N - t * cube_tile);
+		for (int j{ 0 }; j < K; j++) {
+			for (int p{ 0 }; p < paths; p++) {
+				double previous = (j == 0) ? header.initial_share_price : tile[(j - 1) * cube_tile + p];
+				double z = (log(tile[j * cube_tile + p] / previous) - drift) / diffusion;
+				double power{ 1 };
+				for (int k{ 0 }; k < 5; k++, power *= z) power_sums[k] += power;
+			}
+		}
+	}
+
+	double count = power_sums[0];
+	double mean = power_sums[1] / count;
+	double variance = power_sums[2] / count - mean * mean;
+	double third = power_sums[3] / count - 3 * mean * power_sums[2] / count + 2 * pow(mean, 3);
+	double fourth = power_sums[4] / count - 4 * mean * power_sums[3] / count + 6 * pow(mean, 2) * power_sums[2] / count - 3 * pow(mean, 4);
+	return { mean, variance, third / pow(variance, 1.5), fourth / pow(variance, 2) };
+}
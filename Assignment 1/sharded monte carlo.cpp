@@ -0,0 +1,593 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <string>
+#include <limits>
+#include <cstdio>
+#include <stdexcept>
+
+
+// accumulator for one shard, counts and the sketch merge exactly and the sums merge with compensation
+struct shard_accumulator
+{
+	int shard{ 0 };  // index of this shard
+	int shards{ 1 };  // total number of shards in the run
+	unsigned long long seed{ 0 };  // seed of the run
+	long long N{ 0 };  // total number of paths in the run
+	std::vector<double> parameters;  // market and portfolio of the run, from run_parameters
+	long long first_path{ 0 };  // first global path index of this shard
+	long long count{ 0 };  // number of paths
+	double sum{ 0 }, sum_compensation{ 0 };  // compensated sum of the payoffs
+	double sum_sq{ 0 }, sum_sq_compensation{ 0 };  // compensated sum of the squared payoffs
+	double min{ std::numeric_limits<double>::infinity() };
+	double max{ -std::numeric_limits<double>::infinity() };
+	double sketch_lower{ -2000 }, sketch_upper{ 1000 };  // range of the payoff histogram
+	std::vector<long long> sketch = std::vector<long long>(3000, 0);  // payoff histogram
+};
+
+
+// Function declerations
+
+// perform monte carlo over the global path indices [first_path, first_path + count) of a counter based stream
+shard_accumulator MonteCarlo_shard(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const long long& N, const int& shard, const int& shards, const unsigned long long& seed, const int& put_number,
+	const int& call_number, const int& binary_put_number, const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike,
+	const double& call_strike, const double& binary_put_strike, const double& binary_call_strike);
+
+// merge the accumulator of a shard into a running total
+void merge_accumulator(shard_accumulator& total, const shard_accumulator& part);
+
+// market and portfolio parameters of a run, stored in every shard so shards of different runs are never merged
+std::vector<double> run_parameters(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike);
+
+// true if two accumulators come from the same run and their sketches have the same bins
+bool same_run(const shard_accumulator& a, const shard_accumulator& b);
+
+// write a shard accumulator file
+bool write_accumulator(const std::string& file_name, const shard_accumulator& accumulator);
+
+// read a shard accumulator file
+bool read_accumulator(const std::string& file_name, shard_accumulator& accumulator);
+
+// file name of a shard in the shared directory
+std::string shard_file_name(const std::string& directory, const int& shard, const int& shards);
+
+// quantile of the payoff from the histogram sketch
+double sketch_quantile(const shard_accumulator& accumulator, const double& probability);
+
+// standard normal number for a path index, the same index always gives the same number
+double counter_normal(const unsigned long long& seed, const unsigned long long& counter);
+
+// 64 bit mixing function
+unsigned long long splitmix64(unsigned long long x);
+
+// add a value to a compensated (Neumaier) sum
+void compensated_add(double& sum, double& compensation, const double& value);
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price);
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price);
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price);
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price);
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price);
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate portfolio payoff
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number, 
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike, 
+	const double& binary_call_strike, const double& share_price);
+
+// calculate analytical portfolio value
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+
+// Begin main program
+// usage: sharded monte carlo                         run every shard in this process and merge
+//        sharded monte carlo shard <k> <K> <N> <dir>  run shard k of K for a total of N paths
+//        sharded monte carlo merge <K> <dir>          merge the K shard files in dir
+int main(int argc, char* argv[])
+{
+	// constants
+	double expiration{ 0.5 };
+	double volatility{ 0.25 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.01 };
+	double X1{ 450 };
+	double X2{ 700 };
+
+	// portfolio setup
+	int put_number{ 2 };
+	int call_number{ 1 };
+	int binary_put_number{ -700 };
+	int binary_call_number{ 0 };
+	int zero_strike_call_number{ -1 };
+	double put_strike{ X1 };
+	double call_strike{ X2 };
+	double binary_put_strike{ X2 };
+	double binary_call_strike{ 0 };
+	double initial_share_price{ X1 };
+
+	unsigned long long seed{ 20210318 };  // seed shared by every shard of a run
+
+	// default run, every shard in this process
+	std::string mode{ "all" };
+	int shard{ 0 };
+	int shards{ 8 };
+	long long N{ 10000000 };
+	std::string directory{ "." };
+
+	// read the command line, numbers that do not parse or are out of range are rejected so no shard is silently skipped
+	bool valid{ argc == 1 };
+	try {
+		if (argc == 6 && std::string(argv[1]) == "shard") {
+			mode = "shard";
+			shard = std::stoi(argv[2]);
+			shards = std::stoi(argv[3]);
+			N = std::stoll(argv[4]);
+			directory = argv[5];
+			valid = shards > 0 && shard >= 0 && shard < shards && N > 0;
+		}
+		else if (argc == 4 && std::string(argv[1]) == "merge") {
+			mode = "merge";
+			shards = std::stoi(argv[2]);
+			directory = argv[3];
+			valid = shards > 0;
+		}
+	}
+	catch (const std::exception&) {
+		valid = false;
+	}
+	if (!valid) {
+		std::cout << "Error: usage is '" << argv[0] << " shard <k> <K> <N> <dir>' with 0 <= k < K and N > 0, or '" << argv[0]
+			<< " merge <K> <dir>' with K > 0" << std::endl;
+		return 1;
+	}
+
+	// run shards and write their accumulator files
+	for (int k{ 0 }; k < shards && mode != "merge"; k++) {
+
+		if (mode == "shard" && k != shard) continue;
+
+		shard_accumulator accumulator = MonteCarlo_shard(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, k, shards, seed,
+			put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike,
+			binary_call_strike);
+
+		if (!write_accumulator(shard_file_name(directory, k, shards), accumulator)) {
+			std::cout << "Error: could not open file" << std::endl;
+			return 1;
+		}
+		std::cout << "Shard " << k << " of " << shards << ": " << accumulator.count << " paths written" << std::endl;
+	}
+	if (mode == "shard") return 0;
+
+	// what every shard of this run must have been written with, N is taken from the first shard as merge is not given it
+	shard_accumulator expected;
+	expected.shards = shards;
+	expected.seed = seed;
+	expected.parameters = run_parameters(initial_share_price, interest_rate, dividend_rate, volatility, expiration, put_number, call_number,
+		binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike);
+
+	// merge every shard in index order, so the result does not depend on which shard finished first
+	shard_accumulator total;
+	long long next_path{ 0 };
+	for (int k{ 0 }; k < shards; k++) {
+
+		shard_accumulator part;
+		if (!read_accumulator(shard_file_name(directory, k, shards), part)) {
+			std::cout << "Error: could not read shard " << k << std::endl;
+			return 1;
+		}
+
+		// stale shards from a run with another seed, N, market or portfolio are rejected rather than merged
+		if (k == 0) expected.N = part.N;
+		if (!same_run(part, expected)) {
+			std::cout << "Error: shard " << k << " was written by a different run" << std::endl;
+			return 1;
+		}
+
+		// shards must tile the path indices with no gaps or overlaps
+		if (part.shard != k || part.first_path != next_path) {
+			std::cout << "Error: shard " << k << " does not follow on from the previous shard" << std::endl;
+			return 1;
+		}
+		next_path += part.count;
+
+		if (k == 0) total = part;
+		else merge_accumulator(total, part);
+	}
+
+	// and cover every path of the run
+	if (next_path != expected.N) {
+		std::cout << "Error: the shards hold " << next_path << " of the " << expected.N << " paths of the run" << std::endl;
+		return 1;
+	}
+
+	// discounted mean and standard error
+	double discount = exp(-interest_rate * expiration);
+	double mean = (total.sum + total.sum_compensation) / total.count;
+	double mean_sq = (total.sum_sq + total.sum_sq_compensation) / total.count;
+	double standard_error = sqrt(std::max(mean_sq - mean * mean, 0.) / (total.count - 1.));
+
+	// calculate analystical result
+	double current_time = 0;
+	double analytical = portfolio_analytic(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number,
+		put_strike, call_strike, binary_put_strike, binary_call_strike, initial_share_price, interest_rate, dividend_rate, volatility,
+		expiration, current_time);
+
+	// output results
+	std::cout << std::setprecision(10);
+	std::cout << "Merged " << shards << " shards, N = " << total.count << std::endl;
+	std::cout << "Pi = " << discount * mean << " +/- " << discount * standard_error << ", analytic = " << analytical << std::endl;
+	std::cout << "Payoff min = " << total.min << ", max = " << total.max << ", median ~ " << sketch_quantile(total, 0.5)
+		<< ", 99% ~ " << sketch_quantile(total, 0.99) << std::endl;
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// perform monte carlo over the global path indices [first_path, first_path + count) of a counter based stream
+// path i always uses counter i, so the shards of a run see disjoint pieces of one stream whatever K is
+shard_accumulator MonteCarlo_shard(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const long long& N, const int& shard, const int& shards, const unsigned long long& seed, const int& put_number,
+	const int& call_number, const int& binary_put_number, const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike,
+	const double& call_strike, const double& binary_put_strike, const double& binary_call_strike)
+{
+	// split the paths as evenly as possible
+	shard_accumulator accumulator;
+	accumulator.shard = shard;
+	accumulator.shards = shards;
+	accumulator.seed = seed;
+	accumulator.N = N;
+	accumulator.parameters = run_parameters(initial_share_price, interest_rate, dividend_rate, volatility, expiration, put_number, call_number,
+		binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike);
+	accumulator.first_path = N / shards * shard + std::min<long long>(shard, N % shards);
+	accumulator.count = N / shards + (shard < N % shards ? 1 : 0);
+
+	// constants used on every path
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration;
+	double diffusion = volatility * pow(expiration, 0.5);
+	double bin_width = (accumulator.sketch_upper - accumulator.sketch_lower) / accumulator.sketch.size();
+
+	// run the simulations
+	for (long long i{ accumulator.first_path }; i < accumulator.first_path + accumulator.count; i++) {
+
+		// random normal number for this path index
+		double phi = counter_normal(seed, i);
+
+		// get random value of stock value at maturity
+		double final_share_price = initial_share_price * exp(drift + diffusion * phi);
+
+		// accumulate the payoff
+		double payoff = portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+			call_strike, binary_put_strike, binary_call_strike, final_share_price);
+		compensated_add(accumulator.sum, accumulator.sum_compensation, payoff);
+		compensated_add(accumulator.sum_sq, accumulator.sum_sq_compensation, payoff * payoff);
+		accumulator.min = std::min(accumulator.min, payoff);
+		accumulator.max = std::max(accumulator.max, payoff);
+
+		// record the payoff in the sketch, values outside the range go in the end bins
+		long long bin = (long long)floor((payoff - accumulator.sketch_lower) / bin_width);
+		bin = std::max(0LL, std::min(bin, (long long)accumulator.sketch.size() - 1));
+		accumulator.sketch[bin]++;
+	}
+
+	return accumulator;
+}
+
+// merge the accumulator of a shard into a running total, the caller checks same_run first so the sketches line up
+void merge_accumulator(shard_accumulator& total, const shard_accumulator& part)
+{
+	total.count += part.count;
+	compensated_add(total.sum, total.sum_compensation, part.sum);
+	compensated_add(total.sum, total.sum_compensation, part.sum_compensation);
+	compensated_add(total.sum_sq, total.sum_sq_compensation, part.sum_sq);
+	compensated_add(total.sum_sq, total.sum_sq_compensation, part.sum_sq_compensation);
+	total.min = std::min(total.min, part.min);
+	total.max = std::max(total.max, part.max);
+	for (int i{ 0 }; i < total.sketch.size(); i++) total.sketch[i] += part.sketch[i];
+}
+
+// market and portfolio parameters of a run, stored in every shard so shards of different runs are never merged
+std::vector<double> run_parameters(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike)
+{
+	return { initial_share_price, interest_rate, dividend_rate, volatility, expiration, (double)put_number, (double)call_number,
+		(double)binary_put_number, (double)binary_call_number, (double)zero_strike_call_number, put_strike, call_strike, binary_put_strike,
+		binary_call_strike };
+}
+
+// true if two accumulators come from the same run and their sketches have the same bins
+// parameters are written at full precision, so a shard of the same run compares exactly equal
+bool same_run(const shard_accumulator& a, const shard_accumulator& b)
+{
+	return a.shards == b.shards && a.seed == b.seed && a.N == b.N && a.parameters == b.parameters && a.sketch_lower == b.sketch_lower
+		&& a.sketch_upper == b.sketch_upper && a.sketch.size() == b.sketch.size();
+}
+
+// write a shard accumulator file
+bool write_accumulator(const std::string& file_name, const shard_accumulator& accumulator)
+{
+	// write to a temporary and rename, so a merge never sees a half written shard
+	std::string temporary_file = file_name + ".tmp";
+	std::ofstream output(temporary_file);
+	if (!output.is_open()) return false;
+
+	// doubles at full precision so the merge reads back exactly what the shard computed
+	output << std::setprecision(std::numeric_limits<double>::max_digits10);
+	output << "shard " << accumulator.shard << " " << accumulator.shards << std::endl;
+	output << "run " << accumulator.seed << " " << accumulator.N << std::endl;
+	output << "parameters " << accumulator.parameters.size();
+	for (int i{ 0 }; i < accumulator.parameters.size(); i++) output << " " << accumulator.parameters[i];
+	output << std::endl;
+	output << "paths " << accumulator.first_path << " " << accumulator.count << std::endl;
+	output << "sum " << accumulator.sum << " " << accumulator.sum_compensation << std::endl;
+	output << "sum_sq " << accumulator.sum_sq << " " << accumulator.sum_sq_compensation << std::endl;
+	output << "range " << accumulator.min << " " << accumulator.max << std::endl;
+	output << "sketch " << accumulator.sketch_lower << " " << accumulator.sketch_upper << " " << accumulator.sketch.size() << std::endl;
+	for (int i{ 0 }; i < accumulator.sketch.size(); i++) output << accumulator.sketch[i] << std::endl;
+	output.close();
+
+	std::remove(file_name.c_str());
+	return std::rename(temporary_file.c_str(), file_name.c_str()) == 0;
+}
+
+// read a shard accumulator file
+bool read_accumulator(const std::string& file_name, shard_accumulator& accumulator)
+{
+	std::ifstream input(file_name);
+	if (!input.is_open()) return false;
+
+	// read each labelled line, sizes are checked before anything is allocated so a damaged file fails to read
+	std::string label;
+	int parameter_count{ 0 }, sketch_size{ 0 };
+	input >> label >> accumulator.shard >> accumulator.shards;
+	input >> label >> accumulator.seed >> accumulator.N;
+	input >> label >> parameter_count;
+	if (input.fail() || parameter_count < 0 || parameter_count > 1000) return false;
+	accumulator.parameters.assign(parameter_count, 0.);
+	for (int i{ 0 }; i < parameter_count; i++) input >> accumulator.parameters[i];
+	input >> label >> accumulator.first_path >> accumulator.count;
+	input >> label >> accumulator.sum >> accumulator.sum_compensation;
+	input >> label >> accumulator.sum_sq >> accumulator.sum_sq_compensation;
+	input >> label >> accumulator.min >> accumulator.max;
+	input >> label >> accumulator.sketch_lower >> accumulator.sketch_upper >> sketch_size;
+	if (input.fail() || sketch_size <= 0 || sketch_size > 10000000) return false;
+	accumulator.sketch.assign(sketch_size, 0);
+	for (int i{ 0 }; i < sketch_size; i++) input >> accumulator.sketch[i];
+
+	return !input.fail();
+}
+
+// file name of a shard in the shared directory
+std::string shard_file_name(const std::string& directory, const int& shard, const int& shards)
+{
+	return directory + "/shard_" + std::to_string(shard) + "_of_" + std::to_string(shards) + ".acc";
+}
+
+// quantile of the payoff from the histogram sketch
+double sketch_quantile(const shard_accumulator& accumulator, const double& probability)
+{
+	double bin_width = (accumulator.sketch_upper - accumulator.sketch_lower) / accumulator.sketch.size();
+	long long target = (long long)ceil(probability * accumulator.count);
+	long long cumulative{ 0 };
+	for (int i{ 0 }; i < accumulator.sketch.size(); i++) {
+		cumulative += accumulator.sketch[i];
+		if (cumulative >= target) return accumulator.sketch_lower + (i + 0.5) * bin_width;
+	}
+	return accumulator.sketch_upper;
+}
+
+// standard normal number for a path index, the same index always gives the same number
+double counter_normal(const unsigned long long& seed, const unsigned long long& counter)
+{
+	// two independent uniforms in (0, 1) from hashes of the seed and counter
+	unsigned long long key = splitmix64(seed) ^ (2 * counter);
+	double u1 = ((splitmix64(key) >> 11) + 0.5) / 9007199254740992.;
+	double u2 = ((splitmix64(key + 1) >> 11) + 0.5) / 9007199254740992.;
+
+	// Box-Muller
+	return cos(2 * M_PI * u2) * pow(-2 * log(u1), 0.5);
+}
+
+// 64 bit mixing function
+unsigned long long splitmix64(unsigned long long x)
+{
+	x += 0x9e3779b97f4a7c15ULL;
+	x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+	return x ^ (x >> 31);
+}
+
+// add a value to a compensated (Neumaier) sum
+void compensated_add(double& sum, double& compensation, const double& value)
+{
+	double t = sum + value;
+	if (fabs(sum) >= fabs(value)) compensation += (sum - t) + value;
+	else compensation += (value - t) + sum;
+	sum = t;
+}
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return (log(share_price / strike_price) + (interest_rate - divident_rate + pow(volatility, 2) / 2) * (expiration - time)) / (volatility * pow(expiration - time, 0.5));
+}
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time) - volatility * pow(expiration - time, 0.5);
+}
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price) 
+{
+	return std::max(strike_price - share_price, 0.);
+}
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+
+	return strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val) - share_price * exp(-dividend_rate * (expiration - time)) * norm_cumm(-d1_val);
+}
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price) 
+{
+	return std::max(share_price - strike_price, 0.);
+}
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return share_price * exp(-divident_rate * (expiration - time)) * norm_cumm(d1_val) - strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 1;
+	else return 0;
+}
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val);
+}
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 0;
+	else return 1;
+}
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price) 
+{
+	return share_price;
+}
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return share_price * exp(-divident_rate * (expiration - time));
+}
+
+// calculate portfolio value
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price)
+{
+	return put_number * payoff_put(share_price, put_strike) + call_number * payoff_call(share_price, call_strike) +
+		binary_put_number * payoff_binary_put(share_price, binary_put_strike) + binary_call_number * payoff_binary_call(share_price, binary_call_strike) +
+		zero_strike_call_number * payoff_zero_strike_call(share_price);
+}
+
+// calculate analystical portfolio
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return put_number * analytic_put(share_price, put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		call_number * analytic_call(share_price, call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_put_number * analytic_binary_put(share_price, binary_put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_call_number * analytic_binary_call(share_price, binary_call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		zero_strike_call_number * analytic_zero_strike_call(share_price, interest_rate, divident_rate, volatility, expiration, time);
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x) 
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
@@ -0,0 +1,316 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <numeric>
+
+
+// Brownian motion at the monitoring dates of several K, built coarse grid first and refined by Brownian bridge
+class nested_Brownian_path
+{
+public:
+	nested_Brownian_path(const std::vector<int>& K_list, const double& expiration);
+	int size() const { return times.size(); }
+	double time(const int& i) const { return times[i]; }
+	const std::vector<int>& dates(const int& k) const { return date_index[k]; }
+	void build(const std::vector<double>& normals, std::vector<double>& path) const;
+private:
+	std::vector<double> times;
+	std::vector<std::vector<int>> date_index;
+	std::vector<int> bridge_index, left_index, right_index;
+	std::vector<double> left_weight, right_weight, standard_deviation;
+};
+
+
+// Function declerations
+
+// value Asian call for every N and K in the lists from one simulation of max N paths
+void value_Asian_call_grid(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const std::vector<int>& N_list, const std::vector<int>& K_list, std::mt19937& rnd,
+	std::vector<std::vector<double>>& values, std::vector<std::vector<double>>& standard_errors);
+
+// value Asian call
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, std::mt19937& rnd);
+
+// root mean square second difference of the values along K, a measure of how rough the surface is
+double roughness(const std::vector<std::vector<double>>& values);
+
+// Begin main program
+int main()
+{
+	// define parameters
+	double expiration{ 1.25 };
+	double volatility{ 0.37 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.04 };
+	double initial_share_price{ 900 };
+
+	// the grid of 3D mutliple path dependence.cpp
+	std::vector<int> N_list, K_list;
+	for (int N{ 1000 }; N <= 2000; N += 1000) N_list.push_back(N);
+	for (int K{ 20 }; K <= 200; K += 20) K_list.push_back(K);
+
+	// independent paths for every cell
+	std::mt19937 rnd;
+	std::vector<std::vector<double>> independent_values(N_list.size());
+	auto start = std::chrono::steady_clock::now();  // get start time
+	for (int n{ 0 }; n < N_list.size(); n++) {
+		for (int k{ 0 }; k < K_list.size(); k++) {
+			independent_values[n].push_back(value_Asian_call(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N_list[n],
+				K_list[k], rnd));
+		}
+	}
+	auto finish = std::chrono::steady_clock::now();  // get finish time
+	auto elapsed1 = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+	// every cell from one simulation
+	std::mt19937 rnd_shared;
+	std::vector<std::vector<double>> values, standard_errors;
+	start = std::chrono::steady_clock::now();  // get start time
+	value_Asian_call_grid(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N_list, K_list, rnd_shared, values,
+		standard_errors);
+	finish = std::chrono::steady_clock::now();  // get finish time
+	auto elapsed2 = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("path dependence shared paths.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+
+	std::cout << std::setprecision(6);
+	for (int n{ 0 }; n < N_list.size(); n++) {
+		for (int k{ 0 }; k < K_list.size(); k++) {
+			std::cout << "N = " << std::setw(5) << N_list[n] << ", K = " << std::setw(4) << K_list[k] << ": shared = " << std::setw(9) << values[n][k]
+				<< " +- " << std::setw(8) << standard_errors[n][k] << ", independent = " << std::setw(9) << independent_values[n][k] << std::endl;
+			output << N_list[n] << "," << K_list[k] << "," << values[n][k] << "," << standard_errors[n][k] << std::endl;
+		}
+	}
+	output.close();
+
+	std::cout << "roughness along K: shared = " << roughness(values) << ", independent = " << roughness(independent_values) << std::endl;
+	std::cout << "independent time = " << elapsed1.count() << " s, shared time = " << elapsed2.count() << " s, speed up = "
+		<< elapsed1.count() / elapsed2.count() << std::endl;
+
+	// a finer sweep where re-simulating every cell would cost far more
+	N_list = { 5000, 10000, 20000 };
+	K_list.clear();
+	for (int K{ 10 }; K <= 400; K += 10) K_list.push_back(K);
+	start = std::chrono::steady_clock::now();  // get start time
+	value_Asian_call_grid(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N_list, K_list, rnd_shared, values,
+		standard_errors);
+	finish = std::chrono::steady_clock::now();  // get finish time
+	auto elapsed3 = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+	nested_Brownian_path path(K_list, expiration);
+	std::cout << N_list.size() << " x " << K_list.size() << " grid: " << path.size() << " dates per path against "
+		<< std::accumulate(K_list.begin(), K_list.end(), 0) << " steps per path for independent cells, time = " << elapsed3.count()
+		<< " s, roughness = " << roughness(values) << std::endl;
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// Brownian motion at the monitoring dates of several K, built coarse grid first and refined by Brownian bridge
+// dates are the distinct fractions i / K of the expiration; the first K in the list is stepped forward from zero and the new dates
+// of each later K are bridged between their nearest built neighbours, so appending a finer K never changes the path at the dates
+// that were already there
+nested_Brownian_path::nested_Brownian_path(const std::vector<int>& K_list, const double& expiration)
+{
+	// distinct dates as reduced fractions, in the order they are built
+	std::vector<std::pair<int, int>> built;
+	for (int K : K_list) {
+		for (int i{ 1 }; i <= K; i++) {
+			int divisor = std::gcd(i, K);
+			std::pair<int, int> date{ i / divisor, K / divisor };
+			if (std::find(built.begin(), built.end(), date) == built.end()) built.push_back(date);
+		}
+	}
+
+	// position of each date in time order
+	int M = built.size();
+	std::vector<int> order(M);
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(order.begin(), order.end(), [&](const int& a, const int& b) {
+		return (long long)built[a].first * built[b].second < (long long)built[b].first * built[a].second; });
+	std::vector<int> position(M);
+	times = std::vector<double>(M);
+	for (int i{ 0 }; i < M; i++) {
+		position[order[i]] = i;
+		times[i] = expiration * built[order[i]].first / built[order[i]].second;
+	}
+
+	// neighbours already built when each date is added, -1 on the left is time zero and -1 on the right means no right point
+	std::vector<bool> done(M, false);
+	for (int b{ 0 }; b < M; b++) {
+		int i = position[b];
+		int left{ i - 1 }, right{ i + 1 };
+		while (left >= 0 && !done[left]) left--;
+		while (right < M && !done[right]) right++;
+		if (right == M) right = -1;
+
+		double t_left = (left >= 0) ? times[left] : 0;
+		bridge_index.push_back(i);
+		left_index.push_back(left);
+		right_index.push_back(right);
+		if (right < 0) {
+			left_weight.push_back(1);
+			right_weight.push_back(0);
+			standard_deviation.push_back(pow(times[i] - t_left, 0.5));
+		}
+		else {
+			double t_right = times[right];
+			left_weight.push_back((t_right - times[i]) / (t_right - t_left));
+			right_weight.push_back((times[i] - t_left) / (t_right - t_left));
+			standard_deviation.push_back(pow((times[i] - t_left) * (t_right - times[i]) / (t_right - t_left), 0.5));
+		}
+		done[i] = true;
+	}
+
+	// dates of each K as positions in time order
+	for (int K : K_list) {
+		std::vector<int> index;
+		for (int i{ 1 }; i <= K; i++) {
+			int divisor = std::gcd(i, K);
+			std::pair<int, int> date{ i / divisor, K / divisor };
+			index.push_back(position[std::find(built.begin(), built.end(), date) - built.begin()]);
+		}
+		date_index.push_back(index);
+	}
+}
+
+// fill path[i] = W(time(i)) from one normal per date
+void nested_Brownian_path::build(const std::vector<double>& normals, std::vector<double>& path) const
+{
+	for (int b{ 0 }; b < bridge_index.size(); b++) {
+		double W_left = (left_index[b] >= 0) ? path[left_index[b]] : 0;
+		double W_right = (right_index[b] >= 0) ? path[right_index[b]] : 0;
+		path[bridge_index[b]] = left_weight[b] * W_left + right_weight[b] * W_right + standard_deviation[b] * normals[b];
+	}
+}
+
+// value Asian call for every N and K in the lists from one simulation of max N paths
+// each path is built once at the union of all the monitoring dates and the share price computed once per date, every K averages its
+// own dates of that path and the cell for N uses the first N paths, so the whole surface shares its random numbers
+void value_Asian_call_grid(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const std::vector<int>& N_list, const std::vector<int>& K_list, std::mt19937& rnd,
+	std::vector<std::vector<double>>& values, std::vector<std::vector<double>>& standard_errors)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// the dates and the drift of the log share price at each
+	nested_Brownian_path path(K_list, expiration);
+	int M = path.size();
+	double mu = interest_rate - dividend_rate - 0.5 * pow(volatility, 2);
+	std::vector<double> log_drift(M);
+	for (int i{ 0 }; i < M; i++) log_drift[i] = log(initial_share_price) + mu * path.time(i);
+	int terminal = M - 1;
+
+	// initalise sums to zero
+	int max_N = *std::max_element(N_list.begin(), N_list.end());
+	std::vector<double> normals(M), W(M), share_prices(M), sums(K_list.size(), 0.), sums_sq(K_list.size(), 0.);
+	double discount = exp(-interest_rate * expiration);
+	values = std::vector<std::vector<double>>(N_list.size(), std::vector<double>(K_list.size()));
+	standard_errors = values;
+
+	// loop over all MC paths
+	for (int i{ 1 }; i <= max_N; i++) {
+
+		for (int j{ 0 }; j < M; j++) normals[j] = ND(rnd);
+		path.build(normals, W);
+		for (int j{ 0 }; j < M; j++) share_prices[j] = exp(log_drift[j] + volatility * W[j]);
+
+		// add in the payoff of every K
+		for (int k{ 0 }; k < K_list.size(); k++) {
+			const std::vector<int>& dates = path.dates(k);
+			double A_sum{ 0 };
+			for (int j : dates) A_sum += share_prices[j];
+			double payoff = std::max(share_prices[terminal] - A_sum / K_list[k], 0.);
+			sums[k] += payoff;
+			sums_sq[k] += payoff * payoff;
+		}
+
+		// average over the first i paths for any N in the list
+		for (int n{ 0 }; n < N_list.size(); n++) {
+			if (N_list[n] != i) continue;
+			for (int k{ 0 }; k < K_list.size(); k++) {
+				double mean = sums[k] / i;
+				values[n][k] = discount * mean;
+				standard_errors[n][k] = discount * pow((sums_sq[k] / i - mean * mean) / (i - 1.), 0.5);
+			}
+		}
+	}
+}
+
+// value Asian call
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, std::mt19937& rnd)
+{
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every step
+	double dt{ expiration / K };
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt;
+	double diffusion = volatility * pow(dt, 0.5);
+
+	// initalise sum to zero
+	double sum{ 0 };
+
+	// loop over all MC paths
+	for (int i{ 0 }; i < N; i++) {
+
+		double log_share_price = log(initial_share_price);
+		double share_price{ initial_share_price };
+		double A_sum{ 0 };
+		for (int j{ 0 }; j < K; j++) {
+			log_share_price += drift + diffusion * ND(rnd);
+			share_price = exp(log_share_price);
+			A_sum += share_price;
+		}
+
+		// add in the payoff
+		sum += std::max(share_price - A_sum / K, 0.);
+	}
+
+	// average over all paths
+	return exp(-interest_rate * expiration) * sum / N;
+}
+
+// root mean square second difference of the values along K, a measure of how rough the surface is
+double roughness(const std::vector<std::vector<double>>& values)
+{
+	double sum{ 0 };
+	int count{ 0 };
+	for (int n{ 0 }; n < values.size(); n++) {
+		for (int k{ 1 }; k + 1 < values[n].size(); k++) {
+			sum += pow(values[n][k + 1] - 2 * values[n][k] + values[n][k - 1], 2);
+			count++;
+		}
+	}
+	return pow(sum / count, 0.5);
+}
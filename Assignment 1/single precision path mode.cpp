@@ -0,0 +1,474 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+#include <string>
+
+
+// number of paths generated and stepped together
+const int block_size{ 256 };
+
+
+// Function declerations
+
+// perform monte carlo in single or double precision
+double MonteCarlo(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, const bool& single_precision, const unsigned int& seed);
+
+// perform antithetic monte carlo in single or double precision
+double antithetic_MC(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, const bool& single_precision, const unsigned int& seed);
+
+// value Asian call in single or double precision
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const bool& single_precision, const unsigned int& seed);
+
+// terminal value kernel, paths are generated and stepped in type real
+template <typename real>
+double terminal_kernel(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, const bool& antithetic, const unsigned int& seed);
+
+// Asian path kernel, paths are generated and stepped in type real
+template <typename real>
+double Asian_kernel(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const unsigned int& seed);
+
+// fill a block of B standard normals in type real by Box-Muller from 32 bit uniforms
+template <typename real>
+void block_normals(std::mt19937& rng, real* phi, const int& B);
+
+// add a value to a compensated (Neumaier) sum
+void compensated_add(double& sum, double& compensation, const double& value);
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price);
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price);
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price);
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price);
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price);
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate portfolio payoff
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number, 
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike, 
+	const double& binary_call_strike, const double& share_price);
+
+// calculate analytical portfolio value
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+
+// Begin main program
+int main()
+{
+	// constants
+	double expiration{ 0.5 };
+	double volatility{ 0.25 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.01 };
+	double X1{ 450 };
+	double X2{ 700 };
+
+	// portfolio setup
+	int put_number{ 2 };
+	int call_number{ 1 };
+	int binary_put_number{ -700 };
+	int binary_call_number{ 0 };
+	int zero_strike_call_number{ -1 };
+	double put_strike{ X1 };
+	double call_strike{ X2 };
+	double binary_put_strike{ X2 };
+	double binary_call_strike{ 0 };
+	double initial_share_price{ X1 };
+
+	// Asian parameters
+	double Asian_expiration{ 1.25 };
+	double Asian_volatility{ 0.37 };
+	double Asian_interest_rate{ 0.03 };
+	double Asian_dividend_rate{ 0.04 };
+	double Asian_initial_share_price{ 900 };
+	int K{ 35 };  // points in the sample path
+
+	int N{ 1000000 };  // number of monte carlo simulations to perform
+	unsigned int seed{ 5489 };
+
+	// bias check, both precisions use the same uniform draws so any difference is rounding error
+	std::vector<std::string> labels{ "MonteCarlo", "antithetic_MC", "value_Asian_call" };
+	for (int method{ 0 }; method < 3; method++) {
+
+		std::vector<double> values, times;
+		for (int precision{ 0 }; precision < 2; precision++) {
+
+			bool single_precision = precision == 1;
+			auto start = std::chrono::steady_clock::now();  // get start time
+			if (method == 0) values.push_back(MonteCarlo(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, put_number,
+				call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike,
+				binary_call_strike, single_precision, seed));
+			if (method == 1) values.push_back(antithetic_MC(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, put_number,
+				call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike,
+				binary_call_strike, single_precision, seed));
+			if (method == 2) values.push_back(value_Asian_call(Asian_initial_share_price, Asian_interest_rate, Asian_dividend_rate, Asian_volatility,
+				Asian_expiration, N / 10, K, single_precision, seed));
+			auto finish = std::chrono::steady_clock::now();  // get finish time
+			auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // convert into seconds
+			times.push_back(elapsed.count());
+		}
+
+		// output results
+		std::cout << std::setprecision(10) << labels[method] << ": double = " << values[0] << " (" << times[0] << " s), float = " << values[1]
+			<< " (" << times[1] << " s), relative bias = " << (values[1] - values[0]) / fabs(values[0]) << std::endl;
+	}
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// perform monte carlo in single or double precision
+double MonteCarlo(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, const bool& single_precision, const unsigned int& seed)
+{
+	if (single_precision) return terminal_kernel<float>(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, put_number,
+		call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike,
+		false, seed);
+	return terminal_kernel<double>(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, put_number,
+		call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike,
+		false, seed);
+}
+
+// perform antithetic monte carlo in single or double precision
+double antithetic_MC(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, const bool& single_precision, const unsigned int& seed)
+{
+	if (single_precision) return terminal_kernel<float>(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, put_number,
+		call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike,
+		true, seed);
+	return terminal_kernel<double>(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, put_number,
+		call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike,
+		true, seed);
+}
+
+// value Asian call in single or double precision
+double value_Asian_call(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const bool& single_precision, const unsigned int& seed)
+{
+	if (single_precision) return Asian_kernel<float>(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, seed);
+	return Asian_kernel<double>(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N, K, seed);
+}
+
+// terminal value kernel, paths are generated and stepped in type real
+// the normals are made from the same uniforms in both precisions, so only the rounding differs
+template <typename real>
+double terminal_kernel(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, const bool& antithetic, const unsigned int& seed)
+{
+	// declare random number generator
+	std::mt19937 rng(seed);
+
+	// constants in working precision
+	real S0 = real(initial_share_price);
+	real drift = real((interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration);
+	real diffusion = real(volatility * pow(expiration, 0.5));
+
+	// working storage for one block of paths
+	real phi[block_size], share_plus[block_size], share_minus[block_size];
+
+	// initialise compensated sum to 0
+	double sum{ 0 }, compensation{ 0 };
+
+	// run the simulations a block at a time
+	for (int start{ 0 }; start < N; start += block_size) {
+
+		int B = std::min(block_size, N - start);
+
+		// draw the random numbers for the block
+		block_normals(rng, phi, B);
+
+		// get the stock values at maturity for the whole block
+		for (int b{ 0 }; b < B; b++) share_plus[b] = S0 * std::exp(drift + diffusion * phi[b]);
+		if (antithetic) for (int b{ 0 }; b < B; b++) share_minus[b] = S0 * std::exp(drift - diffusion * phi[b]);
+
+		// accumulate the payoffs in double
+		for (int b{ 0 }; b < B; b++) {
+			double payoff = portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+				call_strike, binary_put_strike, binary_call_strike, share_plus[b]);
+			if (antithetic) payoff = 0.5 * (payoff + portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number,
+				zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike, share_minus[b]));
+			compensated_add(sum, compensation, payoff);
+		}
+	}
+
+	// output average over all paths
+	return exp(-interest_rate * expiration) * (sum + compensation) / N;
+}
+
+// Asian path kernel, paths are generated and stepped in type real
+// a block of paths is advanced one time step at a time so the exponentials vectorise across paths
+template <typename real>
+double Asian_kernel(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& K, const unsigned int& seed)
+{
+	// declare random number generator
+	std::mt19937 rng(seed);
+
+	// constants in working precision
+	double dt{ expiration / K };
+	real drift = real((interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * dt);
+	real diffusion = real(volatility * pow(dt, 0.5));
+
+	// working storage for one block of paths
+	real phi[block_size], share[block_size], A_sum[block_size];
+
+	// initialise compensated sum to 0
+	double sum{ 0 }, compensation{ 0 };
+
+	// loop over all MC paths a block at a time
+	for (int start{ 0 }; start < N; start += block_size) {
+
+		int B = std::min(block_size, N - start);
+
+		// initialise the block
+		for (int b{ 0 }; b < B; b++) {
+			share[b] = real(initial_share_price);
+			A_sum[b] = 0;
+		}
+
+		// step every path in the block together
+		for (int j{ 1 }; j <= K; j++) {
+			block_normals(rng, phi, B);
+			for (int b{ 0 }; b < B; b++) {
+				share[b] *= std::exp(drift + diffusion * phi[b]);
+				A_sum[b] += share[b];
+			}
+		}
+
+		// add in the payoffs in double
+		for (int b{ 0 }; b < B; b++) compensated_add(sum, compensation, std::max(double(share[b]) - double(A_sum[b]) / K, 0.));
+	}
+
+	// average over all paths
+	return exp(-interest_rate * expiration) * (sum + compensation) / N;
+}
+
+// fill a block of B standard normals in type real by Box-Muller from 32 bit uniforms
+// each 32 bit draw gives one uniform in (0, 1], and a pair of uniforms gives a pair of normals, so the logarithm, square root,
+// sine and cosine are all worked out in the working precision; an odd B makes one normal more than it needs, phi holds block_size
+template <typename real>
+void block_normals(std::mt19937& rng, real* phi, const int& B)
+{
+	// raw draws for the block
+	unsigned int bits[block_size];
+	int pairs = (B + 1) / 2;
+	for (int b{ 0 }; b < 2 * pairs; b++) bits[b] = rng();
+
+	// uniforms (x + 0.5) 2^-32 are never 0, so the logarithm is finite
+	const real scale = real(1. / 4294967296.);
+	const real two_pi = real(2 * M_PI);
+	for (int b{ 0 }; b < pairs; b++) {
+		real u1 = (real(bits[2 * b]) + real(0.5)) * scale;
+		real u2 = (real(bits[2 * b + 1]) + real(0.5)) * scale;
+		real radius = std::sqrt(real(-2) * std::log(u1));
+		real angle = two_pi * u2;
+		phi[2 * b] = radius * std::cos(angle);
+		phi[2 * b + 1] = radius * std::sin(angle);
+	}
+}
+
+// add a value to a compensated (Neumaier) sum
+void compensated_add(double& sum, double& compensation, const double& value)
+{
+	double t = sum + value;
+	if (fabs(sum) >= fabs(value)) compensation += (sum - t) + value;
+	else compensation += (value - t) + sum;
+	sum = t;
+}
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return (log(share_price / strike_price) + (interest_rate - divident_rate + pow(volatility, 2) / 2) * (expiration - time)) / (volatility * pow(expiration - time, 0.5));
+}
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time) - volatility * pow(expiration - time, 0.5);
+}
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price) 
+{
+	return std::max(strike_price - share_price, 0.);
+}
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+
+	return strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val) - share_price * exp(-dividend_rate * (expiration - time)) * norm_cumm(-d1_val);
+}
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price) 
+{
+	return std::max(share_price - strike_price, 0.);
+}
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return share_price * exp(-divident_rate * (expiration - time)) * norm_cumm(d1_val) - strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 1;
+	else return 0;
+}
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val);
+}
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 0;
+	else return 1;
+}
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price) 
+{
+	return share_price;
+}
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return share_price * exp(-divident_rate * (expiration - time));
+}
+
+// calculate portfolio value
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price)
+{
+	return put_number * payoff_put(share_price, put_strike) + call_number * payoff_call(share_price, call_strike) +
+		binary_put_number * payoff_binary_put(share_price, binary_put_strike) + binary_call_number * payoff_binary_call(share_price, binary_call_strike) +
+		zero_strike_call_number * payoff_zero_strike_call(share_price);
+}
+
+// calculate analystical portfolio
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return put_number * analytic_put(share_price, put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		call_number * analytic_call(share_price, call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_put_number * analytic_binary_put(share_price, binary_put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_call_number * analytic_binary_call(share_price, binary_call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		zero_strike_call_number * analytic_zero_strike_call(share_price, interest_rate, divident_rate, volatility, expiration, time);
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x) 
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
@@ -0,0 +1,404 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <chrono>
+
+
+// Function declerations
+
+// perform monte carlo for every initial share price in the ladder from one set of draws
+std::vector<double> MonteCarlo_spot_ladder(const std::vector<double>& initial_share_prices, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, std::vector<double>& standard_errors);
+
+// perform monte carlo
+double MonteCarlo(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike);
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price);
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price);
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price);
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price);
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price);
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate portfolio payoff
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number, 
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike, 
+	const double& binary_call_strike, const double& share_price);
+
+// calculate analytical portfolio value
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+
+// Begin main program
+int main()
+{
+	// constants
+	double expiration{ 0.5 };
+	double volatility{ 0.25 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.01 };
+	double X1{ 450 };
+	double X2{ 700 };
+
+	// portfolio setup
+	int put_number{ 2 };
+	int call_number{ 1 };
+	int binary_put_number{ -700 };
+	int binary_call_number{ 0 };
+	int zero_strike_call_number{ -1 };
+	double put_strike{ X1 };
+	double call_strike{ X2 };
+	double binary_put_strike{ X2 };
+	double binary_call_strike{ 0 };
+
+	int N{ 100000 };  // number of monte carlo simulations to perform
+	double current_time{ 0 };
+
+	// ladder of initial share prices
+	std::vector<double> initial_share_prices;
+	for (int S{ 10 }; S <= 1150; S += 10) initial_share_prices.push_back(S);
+
+	// value every rung of the ladder from one set of draws
+	auto start1 = std::chrono::steady_clock::now();  // get start time
+	std::vector<double> standard_errors;
+	std::vector<double> ladder_values = MonteCarlo_spot_ladder(initial_share_prices, interest_rate, dividend_rate, volatility, expiration, N,
+		put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike,
+		binary_call_strike, standard_errors);
+	auto finish1 = std::chrono::steady_clock::now();  // get finish time
+	auto elapsed1 = std::chrono::duration_cast<std::chrono::duration<double>> (finish1 - start1);  // convert into seconds
+
+	// value every rung of the ladder with an independent run each
+	auto start2 = std::chrono::steady_clock::now();  // get start time
+	std::vector<double> independent_values;
+	for (int i{ 0 }; i < initial_share_prices.size(); i++) {
+		independent_values.push_back(MonteCarlo(initial_share_prices[i], interest_rate, dividend_rate, volatility, expiration, N, put_number,
+			call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike, call_strike, binary_put_strike, binary_call_strike));
+	}
+	auto finish2 = std::chrono::steady_clock::now();  // get finish time
+	auto elapsed2 = std::chrono::duration_cast<std::chrono::duration<double>> (finish2 - start2);  // convert into seconds
+
+	// analytic values
+	std::vector<double> analytic_values;
+	for (int i{ 0 }; i < initial_share_prices.size(); i++) {
+		analytic_values.push_back(portfolio_analytic(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number,
+			put_strike, call_strike, binary_put_strike, binary_call_strike, initial_share_prices[i], interest_rate, dividend_rate, volatility,
+			expiration, current_time));
+	}
+
+	// measure smoothness of the error across the ladder with the sum of squared second differences
+	double ladder_roughness{ 0 };
+	double independent_roughness{ 0 };
+	for (int i{ 1 }; i < initial_share_prices.size() - 1; i++) {
+		ladder_roughness += pow((ladder_values[i + 1] - analytic_values[i + 1]) - 2 * (ladder_values[i] - analytic_values[i])
+			+ (ladder_values[i - 1] - analytic_values[i - 1]), 2);
+		independent_roughness += pow((independent_values[i + 1] - analytic_values[i + 1]) - 2 * (independent_values[i] - analytic_values[i])
+			+ (independent_values[i - 1] - analytic_values[i - 1]), 2);
+	}
+
+	// output results
+	std::cout << "Spot ladder of " << initial_share_prices.size() << " values with N = " << N << std::endl;
+	std::cout << "Common random numbers: time = " << elapsed1.count() << " s, error roughness = " << ladder_roughness << std::endl;
+	std::cout << "Independent runs:      time = " << elapsed2.count() << " s, error roughness = " << independent_roughness << std::endl;
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("spot_ladder.csv");
+
+	// if the file is open
+	if (output.is_open()) {
+
+		// loop over data containers
+		for (int i{ 0 }; i < initial_share_prices.size(); i++) {
+
+			// write data to file
+			output << initial_share_prices[i] << "," << ladder_values[i] << "," << standard_errors[i] << "," << independent_values[i]
+				<< "," << analytic_values[i] << std::endl;
+		}
+
+		// close the file
+		std::cout << "File write successful" << std::endl;
+		output.close();
+	}
+	// if file could not be opened
+	else {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// perform monte carlo for every initial share price in the ladder from one set of draws
+// under GBM S_T = S_0 * exp((r - q - sigma^2 / 2) T + sigma sqrt(T) phi), so the exponential factor
+// is drawn once per path and each rung only costs a multiply and a payoff evaluation
+std::vector<double> MonteCarlo_spot_ladder(const std::vector<double>& initial_share_prices, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike, std::vector<double>& standard_errors)
+{
+	// declare random number generator
+	static std::mt19937 rng;
+
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// constants used on every path
+	double drift = (interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration;
+	double diffusion = volatility * pow(expiration, 0.5);
+
+	// initialise sums and sums of squares for every rung
+	int M = initial_share_prices.size();
+	std::vector<double> sum(M, 0.), sum_sq(M, 0.);
+
+	// run the simulations
+	for (int i{ 0 }; i < N; i++) {
+
+		// draw a random normally distributed number
+		double phi = ND(rng);
+
+		// lognormal growth factor shared by every rung
+		double growth = exp(drift + diffusion * phi);
+
+		// evaluate the payoff for every initial share price
+		for (int j{ 0 }; j < M; j++) {
+			double payoff = portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+				call_strike, binary_put_strike, binary_call_strike, initial_share_prices[j] * growth);
+			sum[j] += payoff;
+			sum_sq[j] += payoff * payoff;
+		}
+	}
+
+	// output average and standard error for every rung
+	double discount = exp(-interest_rate * expiration);
+	std::vector<double> values(M);
+	standard_errors.assign(M, 0.);
+	for (int j{ 0 }; j < M; j++) {
+		double mean = sum[j] / N;
+		values[j] = discount * mean;
+		standard_errors[j] = discount * sqrt(std::max(sum_sq[j] / N - mean * mean, 0.) / (N - 1.));
+	}
+
+	return values;
+}
+
+// perform monte carlo
+double MonteCarlo(const double& initial_share_price, const double& interest_rate, const double& dividend_rate, const double& volatility,
+	const double& expiration, const int& N, const int& put_number, const int& call_number, const int& binary_put_number,
+	const int& binary_call_number, const int& zero_strike_call_number, const double& put_strike, const double& call_strike,
+	const double& binary_put_strike, const double& binary_call_strike)
+{
+	// declare random number generator
+	static std::mt19937 rng;
+
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// initialise sum to 0
+	double sum = 0;
+
+	// run the simulations
+	for (int i{ 0 }; i < N; i++) {
+
+		// draw a random normally distributed number
+		double phi = ND(rng);
+
+		// get random value of stock value at maturity
+		double final_share_price = initial_share_price * exp((interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration + volatility * phi * pow(expiration, 0.5));
+
+		// increment the sum
+		sum += portfolio_payoff(put_number, call_number, binary_put_number, binary_call_number, zero_strike_call_number, put_strike,
+			call_strike, binary_put_strike, binary_call_strike, final_share_price);
+	}
+
+	// output average over all paths
+	return exp(-interest_rate * expiration) * sum / N;
+}
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return (log(share_price / strike_price) + (interest_rate - divident_rate + pow(volatility, 2) / 2) * (expiration - time)) / (volatility * pow(expiration - time, 0.5));
+}
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time) - volatility * pow(expiration - time, 0.5);
+}
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price) 
+{
+	return std::max(strike_price - share_price, 0.);
+}
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+
+	return strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val) - share_price * exp(-dividend_rate * (expiration - time)) * norm_cumm(-d1_val);
+}
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price) 
+{
+	return std::max(share_price - strike_price, 0.);
+}
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return share_price * exp(-divident_rate * (expiration - time)) * norm_cumm(d1_val) - strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 1;
+	else return 0;
+}
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val);
+}
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 0;
+	else return 1;
+}
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price) 
+{
+	return share_price;
+}
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return share_price * exp(-divident_rate * (expiration - time));
+}
+
+// calculate portfolio value
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price)
+{
+	return put_number * payoff_put(share_price, put_strike) + call_number * payoff_call(share_price, call_strike) +
+		binary_put_number * payoff_binary_put(share_price, binary_put_strike) + binary_call_number * payoff_binary_call(share_price, binary_call_strike) +
+		zero_strike_call_number * payoff_zero_strike_call(share_price);
+}
+
+// calculate analystical portfolio
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return put_number * analytic_put(share_price, put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		call_number * analytic_call(share_price, call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_put_number * analytic_binary_put(share_price, binary_put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_call_number * analytic_binary_call(share_price, binary_call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		zero_strike_call_number * analytic_zero_strike_call(share_price, interest_rate, divident_rate, volatility, expiration, time);
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x) 
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
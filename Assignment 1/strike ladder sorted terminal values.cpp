@@ -0,0 +1,400 @@
+// HEADER
+// Student ID: 10134521
+// Title: Assignment 1
+// Date Created: 16/10/26
+// Last Edited:
+
+
+// math constants
+#define _USE_MATH_DEFINES
+
+
+// Includes
+#include <random>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <math.h>
+#include <vector>
+#include <numeric>
+#include <chrono>
+
+
+// Function declerations
+
+// simulate the share price at maturity for N paths
+std::vector<double> terminal_share_prices(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N);
+
+// value calls, puts, binary calls and binary puts for every strike in the ladder from sorted terminal values
+void MonteCarlo_strike_ladder(std::vector<double> final_share_prices, const std::vector<double>& strikes, const double& interest_rate,
+	const double& expiration, std::vector<std::vector<double>>& values, std::vector<std::vector<double>>& standard_errors);
+
+// mean and standard error of a discounted payoff from its sum and sum of squares
+void discounted_mean_error(const double& sum, const double& sum_sq, const int& N, const double& discount, double& mean, double& standard_error);
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price);
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price);
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price);
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price);
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price);
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// calculate portfolio payoff
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number, 
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike, 
+	const double& binary_call_strike, const double& share_price);
+
+// calculate analytical portfolio value
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time);
+
+// normal cummulative distribution
+double norm_cumm(const double& x);
+
+
+// Begin main program
+int main()
+{
+	// constants
+	double expiration{ 0.5 };
+	double volatility{ 0.25 };
+	double interest_rate{ 0.03 };
+	double dividend_rate{ 0.01 };
+	double initial_share_price{ 700 };
+	double current_time{ 0 };
+
+	int N{ 1000000 };  // number of monte carlo simulations to perform
+
+	// ladder of strikes
+	std::vector<double> strikes;
+	for (int X{ 300 }; X <= 1100; X += 5) strikes.push_back(X);
+
+	// simulate the terminal values once
+	std::vector<double> final_share_prices = terminal_share_prices(initial_share_price, interest_rate, dividend_rate, volatility, expiration, N);
+
+	// value the whole ladder from the sorted terminal values
+	auto start1 = std::chrono::steady_clock::now();  // get start time
+	std::vector<std::vector<double>> values, standard_errors;
+	MonteCarlo_strike_ladder(final_share_prices, strikes, interest_rate, expiration, values, standard_errors);
+	auto finish1 = std::chrono::steady_clock::now();  // get finish time
+	auto elapsed1 = std::chrono::duration_cast<std::chrono::duration<double>> (finish1 - start1);  // convert into seconds
+
+	// value the whole ladder by looping over every strike
+	auto start2 = std::chrono::steady_clock::now();  // get start time
+	std::vector<double> naive_calls;
+	for (int j{ 0 }; j < strikes.size(); j++) {
+		std::vector<double> sum(4, 0.);
+		for (int i{ 0 }; i < N; i++) {
+			sum[0] += payoff_call(final_share_prices[i], strikes[j]);
+			sum[1] += payoff_put(final_share_prices[i], strikes[j]);
+			sum[2] += payoff_binary_call(final_share_prices[i], strikes[j]);
+			sum[3] += payoff_binary_put(final_share_prices[i], strikes[j]);
+		}
+		naive_calls.push_back(exp(-interest_rate * expiration) * sum[0] / N);
+	}
+	auto finish2 = std::chrono::steady_clock::now();  // get finish time
+	auto elapsed2 = std::chrono::duration_cast<std::chrono::duration<double>> (finish2 - start2);  // convert into seconds
+
+	// largest difference to the naive loop and largest error against analytic in standard errors
+	// (only strikes with at least 100 paths either side, the standard error is unreliable in the far tails)
+	double max_naive_difference{ 0 };
+	double max_std_errors{ 0 };
+	for (int j{ 0 }; j < strikes.size(); j++) {
+		max_naive_difference = std::max(max_naive_difference, fabs(values[0][j] - naive_calls[j]));
+		std::vector<double> analytic{
+			analytic_call(initial_share_price, strikes[j], interest_rate, dividend_rate, volatility, expiration, current_time),
+			analytic_put(initial_share_price, strikes[j], interest_rate, dividend_rate, volatility, expiration, current_time),
+			analytic_binary_call(initial_share_price, strikes[j], interest_rate, dividend_rate, volatility, expiration, current_time),
+			analytic_binary_put(initial_share_price, strikes[j], interest_rate, dividend_rate, volatility, expiration, current_time) };
+		double tail = exp(interest_rate * expiration) * std::min(values[2][j], values[3][j]);
+		for (int k{ 0 }; k < 4; k++) {
+			if (tail * N >= 100) max_std_errors = std::max(max_std_errors, fabs(values[k][j] - analytic[k]) / standard_errors[k][j]);
+		}
+	}
+
+	// output results
+	std::cout << "Strike ladder of " << strikes.size() << " strikes with N = " << N << std::endl;
+	std::cout << "Sorted prefix sums: time = " << elapsed1.count() << " s" << std::endl;
+	std::cout << "Loop over strikes:  time = " << elapsed2.count() << " s" << std::endl;
+	std::cout << "Largest difference to loop = " << max_naive_difference << std::endl;
+	std::cout << "Largest error against analytic = " << max_std_errors << " standard errors" << std::endl;
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("strike_ladder.csv");
+
+	// if the file is open
+	if (output.is_open()) {
+
+		// loop over data containers
+		for (int j{ 0 }; j < strikes.size(); j++) {
+
+			// write data to file
+			output << strikes[j];
+			for (int k{ 0 }; k < 4; k++) output << "," << values[k][j] << "," << standard_errors[k][j];
+			output << std::endl;
+		}
+
+		// close the file
+		std::cout << "File write successful" << std::endl;
+		output.close();
+	}
+	// if file could not be opened
+	else {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+
+	return 0;
+}  // End main progrma
+
+
+// Function definitions
+
+// simulate the share price at maturity for N paths
+std::vector<double> terminal_share_prices(const double& initial_share_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const int& N)
+{
+	// declare random number generator
+	static std::mt19937 rng;
+
+	// declare the normal distrubtion
+	std::normal_distribution<double> ND(0., 1.);
+
+	// store the terminal values
+	std::vector<double> final_share_prices(N);
+
+	// run the simulations
+	for (int i{ 0 }; i < N; i++) {
+
+		// draw a random normally distributed number
+		double phi = ND(rng);
+
+		// get random value of stock value at maturity
+		final_share_prices[i] = initial_share_price * exp((interest_rate - dividend_rate - 0.5 * pow(volatility, 2)) * expiration + volatility * phi * pow(expiration, 0.5));
+	}
+
+	return final_share_prices;
+}
+
+// value calls, puts, binary calls and binary puts for every strike in the ladder from sorted terminal values
+// values[0..3] and standard_errors[0..3] hold call, put, binary call and binary put for each strike
+void MonteCarlo_strike_ladder(std::vector<double> final_share_prices, const std::vector<double>& strikes, const double& interest_rate,
+	const double& expiration, std::vector<std::vector<double>>& values, std::vector<std::vector<double>>& standard_errors)
+{
+	int N = final_share_prices.size();
+	int M = strikes.size();
+	double discount = exp(-interest_rate * expiration);
+
+	// sort the terminal values once
+	std::sort(final_share_prices.begin(), final_share_prices.end());
+
+	// prefix sums of S and S^2, prefix[i] is the sum over the i smallest values
+	std::vector<double> prefix(N + 1, 0.), prefix_sq(N + 1, 0.);
+	for (int i{ 0 }; i < N; i++) {
+		prefix[i + 1] = prefix[i] + final_share_prices[i];
+		prefix_sq[i + 1] = prefix_sq[i] + pow(final_share_prices[i], 2);
+	}
+
+	// visit the strikes in ascending order so one sweep over the sorted values places every strike
+	std::vector<int> order(M);
+	std::iota(order.begin(), order.end(), 0);
+	std::sort(order.begin(), order.end(), [&strikes](int a, int b) { return strikes[a] < strikes[b]; });
+
+	values.assign(4, std::vector<double>(M, 0.));
+	standard_errors.assign(4, std::vector<double>(M, 0.));
+
+	int m{ 0 };  // number of terminal values <= strike
+	for (int k{ 0 }; k < M; k++) {
+
+		int j = order[k];
+		double X = strikes[j];
+		while (m < N && final_share_prices[m] <= X) m++;
+
+		// sums of S and S^2 below and above the strike
+		double below = prefix[m], below_sq = prefix_sq[m];
+		double above = prefix[N] - prefix[m], above_sq = prefix_sq[N] - prefix_sq[m];
+
+		// call pays S - X above the strike, put pays X - S below the strike
+		double call_sum = above - X * (N - m);
+		double call_sum_sq = above_sq - 2 * X * above + X * X * (N - m);
+		double put_sum = X * m - below;
+		double put_sum_sq = X * X * m - 2 * X * below + below_sq;
+
+		discounted_mean_error(call_sum, call_sum_sq, N, discount, values[0][j], standard_errors[0][j]);
+		discounted_mean_error(put_sum, put_sum_sq, N, discount, values[1][j], standard_errors[1][j]);
+		discounted_mean_error(N - m, N - m, N, discount, values[2][j], standard_errors[2][j]);
+		discounted_mean_error(m, m, N, discount, values[3][j], standard_errors[3][j]);
+	}
+}
+
+// mean and standard error of a discounted payoff from its sum and sum of squares
+void discounted_mean_error(const double& sum, const double& sum_sq, const int& N, const double& discount, double& mean, double& standard_error)
+{
+	double average = sum / N;
+	mean = discount * average;
+	standard_error = discount * sqrt(std::max(sum_sq / N - average * average, 0.) / (N - 1.));
+}
+
+// calculate d1
+double d1(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return (log(share_price / strike_price) + (interest_rate - divident_rate + pow(volatility, 2) / 2) * (expiration - time)) / (volatility * pow(expiration - time, 0.5));
+}
+
+// calculate d2
+double d2(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time)
+{
+	return d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time) - volatility * pow(expiration - time, 0.5);
+}
+
+// payoff for put
+double payoff_put(const double& share_price, const double& strike_price) 
+{
+	return std::max(strike_price - share_price, 0.);
+}
+
+// analystical put
+double analytic_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& dividend_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, dividend_rate, volatility, expiration, time);
+
+	return strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val) - share_price * exp(-dividend_rate * (expiration - time)) * norm_cumm(-d1_val);
+}
+
+// payoff for call
+double payoff_call(const double& share_price, const double& strike_price) 
+{
+	return std::max(share_price - strike_price, 0.);
+}
+
+// analystical call
+double analytic_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d1_val = d1(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return share_price * exp(-divident_rate * (expiration - time)) * norm_cumm(d1_val) - strike_price * exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for binary put
+double payoff_binary_put(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 1;
+	else return 0;
+}
+
+// analytic binary put
+double analytic_binary_put(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(-d2_val);
+}
+
+// payoff for binary call
+double payoff_binary_call(const double& share_price, const double& strike_price) 
+{
+	if (share_price <= strike_price) return 0;
+	else return 1;
+}
+
+// analytic binary call
+double analytic_binary_call(const double& share_price, const double& strike_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	double d2_val = d2(share_price, strike_price, interest_rate, divident_rate, volatility, expiration, time);
+
+	return exp(-interest_rate * (expiration - time)) * norm_cumm(d2_val);
+}
+
+// payoff for zero strike call
+double payoff_zero_strike_call(const double& share_price) 
+{
+	return share_price;
+}
+
+// analytic zero strike call
+double analytic_zero_strike_call(const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return share_price * exp(-divident_rate * (expiration - time));
+}
+
+// calculate portfolio value
+double portfolio_payoff(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price)
+{
+	return put_number * payoff_put(share_price, put_strike) + call_number * payoff_call(share_price, call_strike) +
+		binary_put_number * payoff_binary_put(share_price, binary_put_strike) + binary_call_number * payoff_binary_call(share_price, binary_call_strike) +
+		zero_strike_call_number * payoff_zero_strike_call(share_price);
+}
+
+// calculate analystical portfolio
+double portfolio_analytic(const int& put_number, const int& call_number, const int& binary_put_number, const int& binary_call_number,
+	const int& zero_strike_call_number, const double& put_strike, const double& call_strike, const double& binary_put_strike,
+	const double& binary_call_strike, const double& share_price, const double& interest_rate, const double& divident_rate,
+	const double& volatility, const double& expiration, const double& time) 
+{
+	return put_number * analytic_put(share_price, put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		call_number * analytic_call(share_price, call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_put_number * analytic_binary_put(share_price, binary_put_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		binary_call_number * analytic_binary_call(share_price, binary_call_strike, interest_rate, divident_rate, volatility, expiration, time) +
+		zero_strike_call_number * analytic_zero_strike_call(share_price, interest_rate, divident_rate, volatility, expiration, time);
+}
+
+// normal cummulative distribution
+double norm_cumm(const double& x) 
+{
+	return 0.5 * erfc(-x / pow(2, 0.5));
+}
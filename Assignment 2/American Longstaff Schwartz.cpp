@@ -0,0 +1,456 @@
+// Includes
+#include <iostream>
+#include <fstream>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <atomic>
+#include <functional>
+
+
+// number of paths in a block, blocks are stored contiguously and are the unit of work handed to threads
+const int LS_block{ 1024 };
+
+
+// convertible bond of American penalty.cpp, dS = kappa (theta(t) - S) dt + sigma S^beta dW stepped by Euler at the exercise dates,
+// coupon C e^(-alpha t) paid continuously, convertible into R S at any exercise date and max(F, R S) at maturity
+class convertible_bond
+{
+public:
+	convertible_bond(const double& T, const double& F, const double& R, const double& r, const double& kappa, const double& mu, const double& S0,
+		const double& X, const double& C, const double& alpha, const double& beta, const double& sigma, const int& dates);
+	int dimension() const { return 1; }
+	int normals() const { return 1; }
+	int dates() const { return K; }
+	double dt() const { return step; }
+	double interest_rate() const { return r; }
+	double scale(const int& k) const { return X; }
+	void initial(double* state) const { state[0] = S0; }
+	void next(const int& i, const double* state, const double* normals, double* next_state) const;
+	double exercise(const int& i, const double* state) const { return (i == K) ? std::max(F, R * state[0]) : R * state[0]; }
+	double cash_flow(const int& i) const { return C * exp(-alpha * i * step) * step; }
+private:
+	double T, F, R, r, kappa, mu, S0, X, C, alpha, beta, sigma, step;
+	int K;
+};
+
+// call on the maximum of d independent GBM assets, exercisable at K equally spaced dates
+class max_call
+{
+public:
+	max_call(const int& d, const double& S0, const double& X, const double& r, const double& q, const double& sigma, const double& T, const int& dates);
+	int dimension() const { return d; }
+	int normals() const { return d; }
+	int dates() const { return K; }
+	double dt() const { return step; }
+	double interest_rate() const { return r; }
+	double scale(const int& k) const { return X; }
+	void initial(double* state) const { for (int k{ 0 }; k < d; k++) state[k] = S0; }
+	void next(const int& i, const double* state, const double* normals, double* next_state) const;
+	double exercise(const int& i, const double* state) const;
+	double cash_flow(const int& i) const { return 0; }
+private:
+	int d, K;
+	double S0, X, r, step, drift, diffusion;
+};
+
+
+// Function declerations
+
+// Longstaff Schwartz value of an American (Bermudan) contract on any model with a polynomial basis of the given degree, lower bound from
+// the regressed exercise rule on fresh paths and upper bound from the dual (Andersen Broadie) with the martingale of the regressed value function
+template <typename model>
+void Longstaff_Schwartz(const model& contract, const int& degree, const bool& include_payoff, const int& N_train, const int& N_lower, const int& N_upper, const int& N_inner,
+	const unsigned int& seed, const int& threads, double& training_value, double& lower, double& lower_error, double& upper, double& upper_error);
+
+// exponents of every monomial in d variables of total degree at most p
+std::vector<std::vector<int>> polynomial_basis(const int& d, const int& p);
+
+// values of the basis functions at a scaled state
+void basis_values(const std::vector<std::vector<int>>& exponents, const double* x, double* phi);
+
+// run work(b) for every block b on several threads, threads take the next free block
+void parallel_blocks(const int& blocks, const int& threads, const std::function<void(const int&)>& work);
+
+// solve A x = b by Gaussian elimination with partial pivoting, false if A is singular
+bool solve_linear_system(std::vector<std::vector<double>> A, std::vector<double> b, std::vector<double>& x);
+
+// Begin main program
+int main()
+{
+	int threads = std::max(1u, std::thread::hardware_concurrency());
+	unsigned int seed{ 20210318 };
+
+	// open a file stream for writing
+	std::ofstream output;
+
+	// open the csv file
+	output.open("American Longstaff Schwartz.csv");
+	if (!output.is_open()) {
+		std::cout << "Error: could not open file" << std::endl;
+		return 1;
+	}
+	output << "contract,degree,payoff in basis,training,lower,lower error,upper,upper error,time" << std::endl;
+	std::cout << std::setprecision(6);
+
+	// the convertible bond of American penalty.cpp, whose penalty Crank Nicolson value at i_max = j_max = 100 is 60.4345
+	convertible_bond bond(2, 50, 1, 0.0114, 0.125, 0.0174, 50.5, 50.5, 0.285, 0.01, 0.869, 0.668, 100);
+
+	// Bermudan max call on two assets, 9 exercise dates (Andersen and Broadie (2004) give 13.90 for S0 = 100)
+	max_call two_assets(2, 100, 100, 0.05, 0.1, 0.2, 3, 9);
+
+	// and on five assets, where a PDE is out of reach
+	max_call five_assets(5, 100, 100, 0.05, 0.1, 0.2, 3, 9);
+
+	// basis choices, the exercise value of the convertible is linear in S so it only enters the max calls
+	for (int degree{ 2 }; degree <= 4; degree++) {
+		for (int c{ 0 }; c < 3; c++) {
+			for (int include_payoff{ 0 }; include_payoff < 2; include_payoff++) {
+
+				const char* name = (c == 0) ? "convertible bond" : (c == 1 ? "max call, 2 assets" : "max call, 5 assets");
+				if ((c == 0 && include_payoff) || (c == 2 && degree > 3)) continue;
+
+				double training, lower, lower_error, upper, upper_error;
+				auto start = std::chrono::steady_clock::now();  // get start time
+				if (c == 0) Longstaff_Schwartz(bond, degree, include_payoff, 100000, 200000, 5000, 50, seed, threads, training, lower, lower_error, upper,
+					upper_error);
+				else if (c == 1) Longstaff_Schwartz(two_assets, degree, include_payoff, 100000, 200000, 5000, 50, seed, threads, training, lower,
+					lower_error, upper, upper_error);
+				else Longstaff_Schwartz(five_assets, degree, include_payoff, 100000, 200000, 5000, 50, seed, threads, training, lower, lower_error, upper,
+					upper_error);
+				auto finish = std::chrono::steady_clock::now();  // get finish time
+				auto elapsed = std::chrono::duration_cast<std::chrono::duration<double>> (finish - start);  // time difference
+
+				std::cout << std::setw(18) << name << ", degree " << degree << (include_payoff ? " + payoff" : "          ") << ": training = "
+					<< std::setw(8) << training << ", lower = " << std::setw(8) << lower << " +- " << std::setw(9) << lower_error << ", upper = "
+					<< std::setw(8) << upper << " +- " << std::setw(9) << upper_error << ", time = " << elapsed.count() << " s" << std::endl;
+				output << name << "," << degree << "," << include_payoff << "," << training << "," << lower << "," << lower_error << "," << upper << ","
+					<< upper_error << "," << elapsed.count() << std::endl;
+			}
+		}
+	}
+	output.close();
+
+	return 0;
+}  // End main program
+
+
+// Function definitions
+
+// convertible bond of American penalty.cpp
+convertible_bond::convertible_bond(const double& T, const double& F, const double& R, const double& r, const double& kappa, const double& mu,
+	const double& S0, const double& X, const double& C, const double& alpha, const double& beta, const double& sigma, const int& dates)
+	: T(T), F(F), R(R), r(r), kappa(kappa), mu(mu), S0(S0), X(X), C(C), alpha(alpha), beta(beta), sigma(sigma), step(T / dates), K(dates)
+{
+}
+
+// Euler step of the share price from date i, absorbed at zero
+void convertible_bond::next(const int& i, const double* state, const double* normals, double* next_state) const
+{
+	double S = state[0];
+	double theta = (1 + mu) * X * exp(mu * i * step);
+	next_state[0] = std::max(S + kappa * (theta - S) * step + sigma * pow(S, beta) * pow(step, 0.5) * normals[0], 0.);
+}
+
+// call on the maximum of d independent GBM assets
+max_call::max_call(const int& d, const double& S0, const double& X, const double& r, const double& q, const double& sigma, const double& T,
+	const int& dates) : d(d), K(dates), S0(S0), X(X), r(r), step(T / dates)
+{
+	drift = exp((r - q - 0.5 * pow(sigma, 2)) * step);
+	diffusion = sigma * pow(step, 0.5);
+}
+
+// exact step of every asset from date i
+void max_call::next(const int& i, const double* state, const double* normals, double* next_state) const
+{
+	for (int k{ 0 }; k < d; k++) next_state[k] = state[k] * drift * exp(diffusion * normals[k]);
+}
+
+double max_call::exercise(const int& i, const double* state) const
+{
+	return std::max(*std::max_element(state, state + d) - X, 0.);
+}
+
+// Longstaff Schwartz value of an American (Bermudan) contract on any model
+// training paths are stored as blocks of [date][variable][path] (SoA) tiles; going back from maturity the realised value of continuing,
+// cash flow plus discounted future value, is regressed on the polynomial basis of the in the money paths, with the normal equations summed
+// per block on the threads and combined in block order, and paths exercise where the exercise value beats the regression;
+// the lower bound applies the regressed rule to N_lower fresh paths, and the upper bound is E[max_i (Z_i - M_i)] over the first N_upper
+// of them, where Z_i is the discounted cash flows plus exercise value at date i and M the martingale of the regressed value function
+// V_i(S) = max(exercise, continuation), its one step conditional expectations estimated with N_inner inner paths
+template <typename model>
+void Longstaff_Schwartz(const model& contract, const int& degree, const bool& include_payoff, const int& N_train, const int& N_lower, const int& N_upper, const int& N_inner,
+	const unsigned int& seed, const int& threads, double& training_value, double& lower, double& lower_error, double& upper, double& upper_error)
+{
+	int d = contract.dimension();
+	int K = contract.dates();
+	double discount = exp(-contract.interest_rate() * contract.dt());
+	std::vector<std::vector<int>> exponents = polynomial_basis(d, degree);
+	int m = exponents.size() + (include_payoff ? 1 : 0);
+
+	// basis functions at date i, the monomials of the scaled state and optionally the exercise value
+	auto basis = [&](const int& i, const double* state, double* x, double* phi) {
+		for (int k{ 0 }; k < d; k++) x[k] = state[k] / contract.scale(k);
+		basis_values(exponents, x, phi);
+		if (include_payoff) phi[m - 1] = contract.exercise(i, state) / contract.scale(0);
+	};
+
+	// continuation value at date i from regression 0 (in the money paths, the exercise rule) or 1 (all paths, the value function of the
+	// dual), paths never exercise at a date without a regression
+	std::vector<std::vector<std::vector<double>>> coefficients(2, std::vector<std::vector<double>>(K));
+	auto continuation = [&](const int& r, const int& i, const double* state, double* x, double* phi) {
+		if (coefficients[r][i].empty()) return HUGE_VAL;
+		basis(i, state, x, phi);
+		double value{ 0 };
+		for (int f{ 0 }; f < m; f++) value += coefficients[r][i][f] * phi[f];
+		return value;
+	};
+
+	// the training paths
+	int blocks = (N_train + LS_block - 1) / LS_block;
+	int tile = (K + 1) * d * LS_block;
+	std::vector<double> paths((size_t)blocks * tile);
+	auto state_index = [&](const int& b, const int& i, const int& k, const int& p) { return (size_t)b * tile + ((size_t)i * d + k) * LS_block + p; };
+	parallel_blocks(blocks, threads, [&](const int& b) {
+		std::seed_seq block_seed{ seed, 0u, (unsigned int)b };
+		std::mt19937 rnd(block_seed);
+		std::normal_distribution<double> ND(0., 1.);
+		std::vector<double> state(d), next_state(d), normals(contract.normals());
+		int P = std::min(LS_block, N_train - b * LS_block);
+		for (int p{ 0 }; p < P; p++) {
+			contract.initial(state.data());
+			for (int k{ 0 }; k < d; k++) paths[state_index(b, 0, k, p)] = state[k];
+			for (int i{ 0 }; i < K; i++) {
+				for (int n{ 0 }; n < contract.normals(); n++) normals[n] = ND(rnd);
+				contract.next(i, state.data(), normals.data(), next_state.data());
+				state = next_state;
+				for (int k{ 0 }; k < d; k++) paths[state_index(b, i + 1, k, p)] = state[k];
+			}
+		}
+	});
+
+	// value of each training path at the current date, starting from the payoff at maturity
+	std::vector<double> values(N_train);
+	parallel_blocks(blocks, threads, [&](const int& b) {
+		std::vector<double> state(d);
+		int P = std::min(LS_block, N_train - b * LS_block);
+		for (int p{ 0 }; p < P; p++) {
+			for (int k{ 0 }; k < d; k++) state[k] = paths[state_index(b, K, k, p)];
+			values[b * LS_block + p] = contract.exercise(K, state.data());
+		}
+	});
+
+	// back through the exercise dates
+	std::vector<std::vector<double>> block_A(blocks, std::vector<double>(2 * m * m)), block_b(blocks, std::vector<double>(2 * m));
+	for (int i{ K - 1 }; i >= 1; i--) {
+
+		// the realised value of continuing from date i, and the normal equations of its regression per block
+		parallel_blocks(blocks, threads, [&](const int& b) {
+			std::vector<double> state(d), x(d), phi(m);
+			std::fill(block_A[b].begin(), block_A[b].end(), 0.);
+			std::fill(block_b[b].begin(), block_b[b].end(), 0.);
+			int P = std::min(LS_block, N_train - b * LS_block);
+			for (int p{ 0 }; p < P; p++) {
+				double& y = values[b * LS_block + p];
+				y = contract.cash_flow(i) + discount * y;
+				for (int k{ 0 }; k < d; k++) state[k] = paths[state_index(b, i, k, p)];
+				basis(i, state.data(), x.data(), phi.data());
+				for (int r{ (contract.exercise(i, state.data()) > 0) ? 0 : 1 }; r < 2; r++) {
+					for (int f{ 0 }; f < m; f++) {
+						for (int g{ 0 }; g <= f; g++) block_A[b][(r * m + f) * m + g] += phi[f] * phi[g];
+						block_b[b][r * m + f] += phi[f] * y;
+					}
+				}
+			}
+		});
+
+		// combine the blocks in a fixed order and solve
+		for (int r{ 0 }; r < 2; r++) {
+			std::vector<std::vector<double>> A(m, std::vector<double>(m, 0.));
+			std::vector<double> rhs(m, 0.);
+			for (int b{ 0 }; b < blocks; b++) {
+				for (int f{ 0 }; f < m; f++) {
+					for (int g{ 0 }; g <= f; g++) A[f][g] += block_A[b][(r * m + f) * m + g];
+					rhs[f] += block_b[b][r * m + f];
+				}
+			}
+			for (int f{ 0 }; f < m; f++) for (int g{ f + 1 }; g < m; g++) A[f][g] = A[g][f];
+			if (!solve_linear_system(A, rhs, coefficients[r][i])) coefficients[r][i].clear();
+		}
+
+		// exercise where it beats the regressed continuation
+		parallel_blocks(blocks, threads, [&](const int& b) {
+			std::vector<double> state(d), x(d), phi(m);
+			int P = std::min(LS_block, N_train - b * LS_block);
+			for (int p{ 0 }; p < P; p++) {
+				for (int k{ 0 }; k < d; k++) state[k] = paths[state_index(b, i, k, p)];
+				double exercise = contract.exercise(i, state.data());
+				if (exercise > 0 && exercise >= continuation(0, i, state.data(), x.data(), phi.data())) values[b * LS_block + p] = exercise;
+			}
+		});
+	}
+
+	// every path starts at the same point, so date 0 continues with the average
+	std::vector<double> state0(d);
+	contract.initial(state0.data());
+	double continue0{ 0 };
+	for (int p{ 0 }; p < N_train; p++) continue0 += contract.cash_flow(0) + discount * values[p];
+	continue0 /= N_train;
+	double exercise0 = contract.exercise(0, state0.data());
+	training_value = std::max(exercise0, continue0);
+
+	// lower and upper bounds on fresh paths
+	int N_bounds = std::max(N_lower, N_upper);
+	int bound_blocks = (N_bounds + LS_block - 1) / LS_block;
+	std::vector<double> block_lower(bound_blocks), block_lower_sq(bound_blocks), block_upper(bound_blocks), block_upper_sq(bound_blocks);
+	parallel_blocks(bound_blocks, threads, [&](const int& b) {
+		std::seed_seq block_seed{ seed, 1u, (unsigned int)b };
+		std::mt19937 rnd(block_seed);
+		std::normal_distribution<double> ND(0., 1.);
+		std::vector<double> state(d), next_state(d), inner_state(d), normals(contract.normals()), x(d), phi(m);
+
+		// regressed value function at date i, the exercise value where the rule exercises and the all path continuation elsewhere
+		auto value_function = [&](const int& i, const double* s) {
+			double exercise = contract.exercise(i, s);
+			if (i == K) return exercise;
+			if (exercise > 0 && exercise >= continuation(0, i, s, x.data(), phi.data())) return exercise;
+			return continuation(1, i, s, x.data(), phi.data());
+		};
+
+		double sum_lower{ 0 }, sum_lower_sq{ 0 }, sum_upper{ 0 }, sum_upper_sq{ 0 };
+		int P = std::min(LS_block, N_bounds - b * LS_block);
+		for (int p{ 0 }; p < P; p++) {
+			bool dual_path = b * LS_block + p < N_upper;
+			contract.initial(state.data());
+
+			// date 0: exercise or continue as in training; Z_0 - M_0 = exercise value
+			double coupons{ 0 }, martingale{ 0 }, df{ 1 };
+			double payoff = (exercise0 >= continue0) ? exercise0 : -1;
+			double dual = exercise0;
+			for (int i{ 0 }; i < K; i++) {
+				coupons += df * contract.cash_flow(i);
+
+				// one step conditional expectation of the value function for the martingale, from antithetic pairs of inner paths
+				double inner_sum{ 0 };
+				for (int n{ 0 }; dual_path && n < N_inner; n += 2) {
+					for (int k{ 0 }; k < contract.normals(); k++) normals[k] = ND(rnd);
+					contract.next(i, state.data(), normals.data(), inner_state.data());
+					inner_sum += value_function(i + 1, inner_state.data());
+					for (int k{ 0 }; k < contract.normals(); k++) normals[k] = -normals[k];
+					contract.next(i, state.data(), normals.data(), inner_state.data());
+					inner_sum += value_function(i + 1, inner_state.data());
+				}
+				for (int k{ 0 }; k < contract.normals(); k++) normals[k] = ND(rnd);
+				contract.next(i, state.data(), normals.data(), next_state.data());
+				state = next_state;
+				df *= discount;
+				if (dual_path) martingale += df * (value_function(i + 1, state.data()) - inner_sum / (2 * ((N_inner + 1) / 2)));
+
+				// the exercise rule and the dual
+				double exercise = contract.exercise(i + 1, state.data());
+				dual = std::max(dual, coupons + df * exercise - martingale);
+				if (payoff < 0 && (i + 1 == K || (exercise > 0 && exercise >= continuation(0, i + 1, state.data(), x.data(), phi.data())))) {
+					payoff = coupons + df * exercise;
+				}
+			}
+			if (b * LS_block + p < N_lower) {
+				sum_lower += payoff;
+				sum_lower_sq += payoff * payoff;
+			}
+			if (dual_path) {
+				sum_upper += dual;
+				sum_upper_sq += dual * dual;
+			}
+		}
+		block_lower[b] = sum_lower;
+		block_lower_sq[b] = sum_lower_sq;
+		block_upper[b] = sum_upper;
+		block_upper_sq[b] = sum_upper_sq;
+	});
+
+	// average over all paths
+	double sum_lower{ 0 }, sum_lower_sq{ 0 }, sum_upper{ 0 }, sum_upper_sq{ 0 };
+	for (int b{ 0 }; b < bound_blocks; b++) {
+		sum_lower += block_lower[b];
+		sum_lower_sq += block_lower_sq[b];
+		sum_upper += block_upper[b];
+		sum_upper_sq += block_upper_sq[b];
+	}
+	lower = sum_lower / N_lower;
+	lower_error = pow((sum_lower_sq / N_lower - lower * lower) / (N_lower - 1.), 0.5);
+	upper = sum_upper / N_upper;
+	upper_error = pow((sum_upper_sq / N_upper - upper * upper) / (N_upper - 1.), 0.5);
+}
+
+// exponents of every monomial in d variables of total degree at most p
+std::vector<std::vector<int>> polynomial_basis(const int& d, const int& p)
+{
+	std::vector<std::vector<int>> exponents{ std::vector<int>(d, 0) };
+	for (int total{ 1 }; total <= p; total++) {
+
+		// every way of writing total as an ordered sum of d non negative exponents
+		std::vector<int> e(d, 0);
+		e[0] = total;
+		while (true) {
+			exponents.push_back(e);
+			int k = d - 2;
+			while (k >= 0 && e[k] == 0) k--;
+			if (k < 0) break;
+			e[k]--;
+			int rest = e[d - 1] + 1;
+			e[d - 1] = 0;
+			e[k + 1] = rest;
+		}
+	}
+	return exponents;
+}
+
+// values of the basis functions at a scaled state
+void basis_values(const std::vector<std::vector<int>>& exponents, const double* x, double* phi)
+{
+	for (int f{ 0 }; f < exponents.size(); f++) {
+		double value{ 1 };
+		for (int k{ 0 }; k < exponents[f].size(); k++) for (int e{ 0 }; e < exponents[f][k]; e++) value *= x[k];
+		phi[f] = value;
+	}
+}
+
+// run work(b) for every block b on several threads, threads take the next free block
+void parallel_blocks(const int& blocks, const int& threads, const std::function<void(const int&)>& work)
+{
+	std::atomic<int> next_block{ 0 };
+	auto run = [&]() { for (int b = next_block++; b < blocks; b = next_block++) work(b); };
+	std::vector<std::thread> pool;
+	for (int t{ 1 }; t < threads; t++) pool.push_back(std::thread(run));
+	run();
+	for (int t{ 0 }; t < pool.size(); t++) pool[t].join();
+}
+
+// solve A x = b by Gaussian elimination with partial pivoting, false if A is singular
+bool solve_linear_system(std::vector<std::vector<double>> A, std::vector<double> b, std::vector<double>& x)
+{
+	int n = b.size();
+	for (int c{ 0 }; c < n; c++) {
+		int pivot = c;
+		for (int r{ c + 1 }; r < n; r++) if (fabs(A[r][c]) > fabs(A[pivot][c])) pivot = r;
+		if (fabs(A[pivot][c]) < 1e-300) return false;
+		std::swap(A[c], A[pivot]);
+		std::swap(b[c], b[pivot]);
+		for (int r{ c + 1 }; r < n; r++) {
+			double factor = A[r][c] / A[c][c];
+			for (int k{ c }; k < n; k++) A[r][k] -= factor * A[c][k];
+			b[r] -= factor * b[c];
+		}
+	}
+	x = std::vector<double>(n);
+	for (int r{ n - 1 }; r >= 0; r--) {
+		double sum = b[r];
+		for (int k{ r + 1 }; k < n; k++) sum -= A[r][k] * x[k];
+		x[r] = sum / A[r][r];
+	}
+	return true;
+}